@@ -0,0 +1,419 @@
+#!/usr/bin/env python3
+"""Bytes of a binary taken by frozen strings, and how much of them is padding.
+
+A frozen::basic_string<Char, N> always stores N characters and its length,
+so a short string in a large capacity is mostly NULs.  This report walks the
+symbol table and the debug information of an ELF file and attributes the
+bytes of the allocated data sections to every frozen::basic_string object,
+also inside arrays and classes such as frozen::sorted_set,
+and to every frozen::meta::basic_string<>::value:
+
+    python3 bench/binary_size/rodata.py tu.cpp --cxxflags='-std=c++17 -O2'
+    python3 bench/binary_size/rodata.py build/server --top 50 --csv strings.csv
+
+A source file is compiled into a shared object with -g, so it needs no
+main(); a binary must be linked (not a .o file) and built with -g for
+frozen::basic_string objects to be found, meta::basic_string symbols are
+found by their names alone.  Only binutils (readelf, c++filt) are used.
+"""
+
+import argparse
+import collections
+import csv
+import os
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+# sizeof(Char) on the ELF targets, by the name debug information gives
+CHAR_WIDTHS = {'char': 1, 'signed char': 1, 'unsigned char': 1, 'char8_t': 1,
+               'char16_t': 2, 'char32_t': 4, 'wchar_t': 4}
+
+ENCODINGS = {1: 'utf-8', 2: 'utf-16', 4: 'utf-32'}
+
+
+class Elf(object):
+    """The sections and symbols of an ELF file, and its bytes by address."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        if self.data[:4] != b'\x7fELF':
+            raise ValueError('%s is not an ELF file' % path)
+        self.is64 = self.data[4] == 2
+        self.endian = '<' if self.data[5] == 1 else '>'
+        self.word = 8 if self.is64 else 4
+        if self.is64:
+            e_type, = self.unpack('H', 16)
+            shoff, = self.unpack('Q', 40)
+            shentsize, shnum, shstrndx = self.unpack('HHH', 58)
+        else:
+            e_type, = self.unpack('H', 16)
+            shoff, = self.unpack('I', 32)
+            shentsize, shnum, shstrndx = self.unpack('HHH', 46)
+        self.relocatable = e_type == 1
+
+        self.sections = []
+        for i in range(shnum):
+            at = shoff + i * shentsize
+            if self.is64:
+                name, kind, flags, addr, offset, size, link, _, _, entsize = self.unpack('IIQQQQIIQQ', at)
+            else:
+                name, kind, flags, addr, offset, size, link, _, _, entsize = self.unpack('IIIIIIIIII', at)
+            self.sections.append({'name': name, 'type': kind, 'flags': flags, 'addr': addr,
+                                  'offset': offset, 'size': size, 'link': link, 'entsize': entsize})
+        names = self.sections[shstrndx]
+        for s in self.sections:
+            s['name'] = self.string(names['offset'] + s['name'])
+
+    def unpack(self, fmt, at):
+        return struct.unpack_from(self.endian + fmt, self.data, at)
+
+    def string(self, at):
+        return self.data[at:self.data.index(b'\0', at)].decode('utf-8', 'replace')
+
+    def allocated(self):
+        """the sections which take memory at run time and hold data, not code"""
+        SHF_ALLOC, SHF_EXECINSTR = 0x2, 0x4
+        return [s for s in self.sections if s['flags'] & SHF_ALLOC and not s['flags'] & SHF_EXECINSTR
+                and s['size'] > 0 and not s['name'].startswith(('.note', '.gnu', '.dyn', '.rela', '.rel.',
+                                                                  '.interp', '.eh_frame', '.init_array',
+                                                                  '.fini_array', '.got', '.plt'))]
+
+    def read(self, addr, size):
+        """size bytes at addr, zeros in .bss"""
+        SHT_NOBITS = 8
+        for s in self.sections:
+            if s['addr'] <= addr and addr + size <= s['addr'] + s['size'] and s['addr'] != 0:
+                if s['type'] == SHT_NOBITS:
+                    return b'\0' * size
+                at = s['offset'] + addr - s['addr']
+                return self.data[at:at + size]
+        return None
+
+    def section_of(self, addr):
+        for s in self.sections:
+            if s['addr'] <= addr < s['addr'] + s['size'] and s['addr'] != 0:
+                return s['name']
+        return ''
+
+    def symbols(self):
+        """(name, address, size) of the data objects of .symtab, or of .dynsym if stripped"""
+        SHT_SYMTAB, SHT_DYNSYM, STT_OBJECT = 2, 11, 1
+        tables = [s for s in self.sections if s['type'] == SHT_SYMTAB] or \
+                 [s for s in self.sections if s['type'] == SHT_DYNSYM]
+        result = []
+        for table in tables:
+            strings = self.sections[table['link']]['offset']
+            for at in range(table['offset'], table['offset'] + table['size'], table['entsize']):
+                if self.is64:
+                    name, info, _, _, value, size = self.unpack('IBBHQQ', at)
+                else:
+                    name, value, size, info, _, _ = self.unpack('IIIBBH', at)
+                if info & 0xf == STT_OBJECT and size > 0:
+                    result.append((self.string(strings + name), value, size))
+        return result
+
+
+def demangle(names):
+    if not names:
+        return []
+    p = subprocess.run(['c++filt'], input='\n'.join(names) + '\n',
+                       stdout=subprocess.PIPE, universal_newlines=True, check=True)
+    return p.stdout.split('\n')[:len(names)]
+
+
+class Dwarf(object):
+    """The entries of .debug_info, from the output of readelf."""
+
+    DIE = re.compile(r'^\s*<(\d+)><([0-9a-f]+)>: Abbrev Number: (\d+)(?: \((DW_TAG_\w+)\))?')
+    ATTRIBUTE = re.compile(r'^\s*<[0-9a-f]+>\s+(DW_AT_\w+)\s*:\s*(.*)$')
+
+    def __init__(self, path):
+        out = subprocess.run(['readelf', '--wide', '--debug-dump=info', path],
+                             stdout=subprocess.PIPE, stderr=subprocess.DEVNULL,
+                             universal_newlines=True).stdout
+        self.entries = {}
+        parents = {}
+        current = None
+        for line in out.splitlines():
+            m = self.DIE.match(line)
+            if m:
+                depth, offset, abbrev, tag = int(m.group(1)), int(m.group(2), 16), m.group(3), m.group(4)
+                current = None
+                if abbrev == '0':
+                    continue
+                current = {'tag': tag, 'parent': parents.get(depth - 1), 'children': []}
+                self.entries[offset] = current
+                parents[depth] = offset
+                if current['parent'] is not None:
+                    self.entries[current['parent']]['children'].append(offset)
+                continue
+            m = self.ATTRIBUTE.match(line)
+            if m and current is not None:
+                current[m.group(1)] = m.group(2)
+
+    @staticmethod
+    def ref(value):
+        m = re.search(r'<0x([0-9a-f]+)>', value or '')
+        return int(m.group(1), 16) if m else None
+
+    @staticmethod
+    def text(value):
+        # "(strp) (offset: 0x1f): name", "(string) name", "(line_strp) (offset: 0x3): name"
+        value = re.sub(r'^\(\w+\)\s*', '', value or '')
+        return re.sub(r'^\((?:indirect (?:line )?string, )?offset: 0x[0-9a-f]+\):\s*', '', value)
+
+    @staticmethod
+    def number(value):
+        m = re.search(r'(0x[0-9a-f]+|-?\d+)\s*$', value or '')
+        return int(m.group(1), 0) if m else None
+
+    def name(self, offset):
+        e = self.entries.get(offset, {})
+        if 'DW_AT_name' in e:
+            return self.text(e['DW_AT_name'])
+        for origin in ('DW_AT_specification', 'DW_AT_abstract_origin'):
+            if origin in e:
+                return self.name(self.ref(e[origin]))
+        return None
+
+    def qualified(self, offset):
+        """the name of an entry with its enclosing namespaces and classes"""
+        e = self.entries.get(offset, {})
+        for origin in ('DW_AT_specification', 'DW_AT_abstract_origin'):
+            if origin in e and 'DW_AT_name' not in e:
+                return self.qualified(self.ref(e[origin]))
+        parts = [self.name(offset) or '']
+        parent = e.get('parent')
+        while parent is not None:
+            p = self.entries[parent]
+            if p['tag'] in ('DW_TAG_namespace', 'DW_TAG_class_type', 'DW_TAG_structure_type'):
+                parts.append(self.name(parent) or '(anonymous namespace)')
+            parent = p.get('parent')
+        return '::'.join(reversed(parts))
+
+    def type_of(self, offset):
+        e = self.entries.get(offset, {})
+        if 'DW_AT_type' in e:
+            return self.ref(e['DW_AT_type'])
+        for origin in ('DW_AT_specification', 'DW_AT_abstract_origin'):
+            if origin in e:
+                return self.type_of(self.ref(e[origin]))
+        return None
+
+    def strip(self, offset):
+        """the type without const, volatile and typedefs"""
+        while offset is not None and self.entries.get(offset, {}).get('tag') in (
+                'DW_TAG_const_type', 'DW_TAG_volatile_type', 'DW_TAG_typedef'):
+            offset = self.ref(self.entries[offset].get('DW_AT_type'))
+        return offset
+
+    def variables(self, addresses):
+        """(qualified name, type, address) of the variables with a static address;
+        a constexpr variable may have a value but no location, its address is
+        then looked up by name in addresses"""
+        seen = set()
+        for offset, e in self.entries.items():
+            if e['tag'] != 'DW_TAG_variable' or 'DW_AT_declaration' in e:
+                continue
+            name = self.qualified(offset)
+            m = re.search(r'\(DW_OP_addr: ([0-9a-f]+)\)\s*$', e.get('DW_AT_location', ''))
+            addr = int(m.group(1), 16) if m else addresses.get(name)
+            if addr is not None and addr not in seen:
+                seen.add(addr)
+                yield name, self.type_of(offset), addr
+
+
+FROZEN_STRING = re.compile(r'^frozen::basic_string<(.+), (\d+)(?:ul|u|l)?>$')
+META_STRING = re.compile(r'^frozen::meta::basic_string<([^,>]+)(?:, .*)?>::value$')
+
+
+def frozen_strings(dwarf, addresses):
+    """every frozen::basic_string object: (name, address, type offset)"""
+    found = []
+
+    def walk(name, addr, offset, depth):
+        offset = dwarf.strip(offset)
+        e = dwarf.entries.get(offset)
+        if e is None or depth > 32:
+            return
+        if e['tag'] in ('DW_TAG_class_type', 'DW_TAG_structure_type'):
+            if FROZEN_STRING.match(dwarf.qualified(offset)):
+                found.append((name, addr, offset))
+                return
+            for child in e['children']:
+                c = dwarf.entries[child]
+                if c['tag'] in ('DW_TAG_member', 'DW_TAG_inheritance') and 'DW_AT_data_member_location' in c:
+                    where = addr + dwarf.number(c['DW_AT_data_member_location'])
+                    label = name if c['tag'] == 'DW_TAG_inheritance' else '%s.%s' % (name, dwarf.name(child))
+                    walk(label, where, dwarf.ref(c.get('DW_AT_type')), depth + 1)
+        elif e['tag'] == 'DW_TAG_array_type':
+            element = dwarf.strip(dwarf.ref(e.get('DW_AT_type')))
+            size = dwarf.number(dwarf.entries.get(element, {}).get('DW_AT_byte_size'))
+            counts = []
+            for child in e['children']:
+                c = dwarf.entries[child]
+                if 'DW_AT_count' in c:
+                    counts.append(dwarf.number(c['DW_AT_count']))
+                elif 'DW_AT_upper_bound' in c:
+                    counts.append(dwarf.number(c['DW_AT_upper_bound']) + 1)
+            if not size or not counts or None in counts:
+                return
+            # the elements of a multidimensional array in row-major order
+            labels = ['']
+            for n in counts:
+                labels = ['%s[%d]' % (label, i) for label in labels for i in range(n)]
+            for i, label in enumerate(labels):
+                walk(name + label, addr + i * size, element, depth + 1)
+
+    for name, offset, addr in dwarf.variables(addresses):
+        walk(name, addr, offset, 0)
+    return found
+
+
+def describe_frozen(dwarf, elf, name, addr, offset):
+    m = FROZEN_STRING.match(dwarf.qualified(offset))
+    char, capacity = m.group(1), max(int(m.group(2)), 1)
+    width = CHAR_WIDTHS.get(char, 1)
+    size = dwarf.number(dwarf.entries[offset].get('DW_AT_byte_size')) or 0
+    length_at = size - elf.word
+    for child in dwarf.entries[offset]['children']:
+        if dwarf.name(child) == 'length' and 'DW_AT_data_member_location' in dwarf.entries[child]:
+            length_at = dwarf.number(dwarf.entries[child]['DW_AT_data_member_location'])
+    raw = elf.read(addr, size)
+    if raw is None:
+        return None
+    length, = struct.unpack_from(elf.endian + ('Q' if elf.word == 8 else 'I'), raw, length_at)
+    length = min(length, capacity)
+    return {'object': name, 'type': 'frozen::basic_string<%s, %d>' % (char, capacity), 'char': char,
+            'section': elf.section_of(addr), 'bytes': size, 'length': length, 'capacity': capacity,
+            'chars': length * width, 'nul_padding': (capacity - length) * width,
+            'other': size - capacity * width, 'content': raw[:length * width]}
+
+
+def describe_meta(elf, name, addr, size):
+    char = META_STRING.match(name).group(1)
+    width = CHAR_WIDTHS.get(char, 1)
+    raw = elf.read(addr, size) or b''
+    length = size // width - 1
+    return {'object': name, 'type': 'frozen::meta::basic_string<%s, ...>' % char, 'char': char,
+            'section': elf.section_of(addr), 'bytes': size, 'length': length, 'capacity': length + 1,
+            'chars': length * width, 'nul_padding': width, 'other': size - (length + 1) * width,
+            'content': raw[:length * width]}
+
+
+def show(row, limit=40):
+    text = row['content'].decode(ENCODINGS.get(CHAR_WIDTHS.get(row['char'], 1)) + ('-le' if CHAR_WIDTHS.get(row['char'], 1) > 1 else ''), 'replace')
+    text = text if len(text) <= limit else text[:limit - 3] + '...'
+    return '"%s"' % text.encode('unicode_escape').decode('ascii').replace('"', '\\"')
+
+
+def compile_source(source, cxx, cxxflags, tmp):
+    out = os.path.join(tmp, os.path.splitext(os.path.basename(source))[0] + '.so')
+    cmd = [cxx] + cxxflags + ['-g', '-fPIC', '-shared', '-I', ROOT, source, '-o', out]
+    p = subprocess.run(cmd, stderr=subprocess.PIPE, universal_newlines=True)
+    if p.returncode != 0:
+        sys.stderr.write(p.stderr)
+        sys.exit('%s failed' % ' '.join(cmd))
+    return out
+
+
+def report(path, label, top, out):
+    elf = Elf(path)
+    if elf.relocatable:
+        sys.exit('%s is a relocatable object: link it, or give its source file' % path)
+
+    symbols = elf.symbols()
+    names = demangle([s[0] for s in symbols])
+    addresses = dict((name, addr) for name, (_, addr, _) in zip(names, symbols))
+
+    rows = []
+    dwarf = Dwarf(path)
+    for name, addr, offset in frozen_strings(dwarf, addresses):
+        row = describe_frozen(dwarf, elf, name, addr, offset)
+        if row is not None:
+            rows.append(row)
+    for name, (_, addr, size) in zip(names, symbols):
+        if META_STRING.match(name):
+            rows.append(describe_meta(elf, name, addr, size))
+    if not dwarf.entries:
+        sys.stderr.write('%s has no debug information: only meta::basic_string is counted\n' % path)
+
+    sections = elf.allocated()
+    data_bytes = sum(s['size'] for s in sections)
+    write = out.write
+    write('frozen strings in %s\n\n' % label)
+    write('%-24s %10s\n' % ('section', 'bytes'))
+    for s in sections:
+        write('%-24s %10d\n' % (s['name'], s['size']))
+    write('%-24s %10d\n\n' % ('total', data_bytes))
+
+    by_type = collections.OrderedDict()
+    for r in sorted(rows, key=lambda r: (r['type'], r['capacity'])):
+        t = by_type.setdefault(r['type'], collections.Counter())
+        t.update({'objects': 1, 'bytes': r['bytes'], 'chars': r['chars'],
+                  'nul_padding': r['nul_padding'], 'other': r['other'], 'length': r['length']})
+    write('%-44s %8s %10s %10s %12s %8s %12s\n' % ('type', 'objects', 'bytes', 'chars', 'NUL padding', 'other', 'mean length'))
+    total = collections.Counter()
+    for t, c in sorted(by_type.items(), key=lambda kv: -kv[1]['bytes']):
+        write('%-44s %8d %10d %10d %12d %8d %12.1f\n' % (t, c['objects'], c['bytes'], c['chars'], c['nul_padding'],
+                                                           c['other'], float(c['length']) / c['objects']))
+        total.update(c)
+    write('%-44s %8d %10d %10d %12d %8d\n' % ('total', total['objects'], total['bytes'], total['chars'],
+                                               total['nul_padding'], total['other']))
+    if data_bytes:
+        write('%.1f%% of the data sections are frozen strings, %.1f%% are NUL padding\n'
+              % (100.0 * total['bytes'] / data_bytes, 100.0 * total['nul_padding'] / data_bytes))
+
+    write('\nthe most padded objects\n')
+    write('%8s %12s %17s  %s\n' % ('bytes', 'NUL padding', 'length/capacity', 'object'))
+    for r in sorted(rows, key=lambda r: -r['nul_padding'])[:top]:
+        write('%8d %12d %17s  %s %s\n' % (r['bytes'], r['nul_padding'], '%d/%d' % (r['length'], r['capacity']),
+                                         r['object'], show(r)))
+
+    copies = collections.defaultdict(list)
+    for r in rows:
+        copies[(r['char'], r['content'])].append(r)
+    duplicates = sorted((rs for rs in copies.values() if len(rs) > 1), key=lambda rs: -sum(r['bytes'] for r in rs))
+    write('\nstrings stored more than once\n')
+    write('%8s %8s  %s\n' % ('copies', 'bytes', 'string'))
+    for rs in duplicates[:top]:
+        write('%8d %8d  %s  %s\n' % (len(rs), sum(r['bytes'] for r in rs), show(rs[0]),
+                                     ', '.join(r['object'] for r in rs[:4]) + (', ...' if len(rs) > 4 else '')))
+    if not duplicates:
+        write('%8s\n' % '-')
+    return rows
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('file', help='a C++ source file, or a linked ELF binary or shared object built with -g')
+    parser.add_argument('--cxx', default='g++')
+    parser.add_argument('--cxxflags', default='-std=c++14 -O2')
+    parser.add_argument('--top', type=int, default=20, help='how many objects and duplicates to list')
+    parser.add_argument('--csv', help='write one row per string object to this file')
+    args = parser.parse_args()
+
+    if not os.path.isfile(args.file):
+        sys.exit('%s: no such file' % args.file)
+    with tempfile.TemporaryDirectory() as tmp:
+        path = args.file
+        if os.path.splitext(path)[1] in ('.cpp', '.cc', '.cxx', '.C'):
+            path = compile_source(path, args.cxx, args.cxxflags.split(), tmp)
+        rows = report(path, args.file, args.top, sys.stdout)
+
+    if args.csv:
+        with open(args.csv, 'w', newline='') as f:
+            writer = csv.DictWriter(f, fieldnames=['object', 'type', 'section', 'bytes', 'length', 'capacity',
+                                                   'chars', 'nul_padding', 'other'], extrasaction='ignore')
+            writer.writeheader()
+            writer.writerows(rows)
+
+
+if __name__ == '__main__':
+    main()
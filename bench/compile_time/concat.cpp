@@ -0,0 +1,37 @@
+// Compile-time cost of frozen::concat() against an operator+ chain.
+//
+// Both variants build the same 40-operand string; compile with
+// -DFROZEN_BENCH_USE_CONCAT for frozen::concat().  See concat.py.
+
+#include "../../frozen/string.hpp"
+
+#define FROZEN_BENCH_OPERANDS(SEP) \
+    "{\"id\" : " SEP 12345 SEP ',' SEP \
+    "\"name\" : \"frozen\"" SEP ',' SEP \
+    "\"ratio\" : " SEP 0.5 SEP ',' SEP \
+    "\"count\" : " SEP 42 SEP ',' SEP \
+    "\"port\" : " SEP 8080 SEP ',' SEP \
+    "\"retries\" : " SEP 3 SEP ',' SEP \
+    "\"timeout\" : " SEP 30 SEP ',' SEP \
+    "\"depth\" : " SEP 4 SEP ',' SEP \
+    "\"size\" : " SEP 100 SEP ',' SEP \
+    "\"limit\" : " SEP 65535 SEP ',' SEP \
+    "\"delay\" : " SEP 250 SEP ',' SEP \
+    "\"level\" : " SEP 7 SEP ',' SEP \
+    "\"cores\" : " SEP 16 SEP '}'
+
+#define FROZEN_BENCH_COMMA ,
+#define FROZEN_BENCH_PLUS +
+
+#if defined FROZEN_BENCH_USE_CONCAT
+constexpr auto result = frozen::concat(FROZEN_BENCH_OPERANDS(FROZEN_BENCH_COMMA));
+#else
+constexpr auto result = frozen::empty_str + FROZEN_BENCH_OPERANDS(FROZEN_BENCH_PLUS);
+#endif
+
+static_assert(result.size() > 0, "");
+
+int main()
+{
+    return static_cast<int>(result.size() % 2);
+}
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+"""Compare compile time and peak compiler memory of an operator+ chain and
+frozen::concat() building the same string (bench/compile_time/concat.cpp).
+
+    CXX=clang++ python3 bench/compile_time/concat.py
+"""
+
+import os
+import subprocess
+import sys
+import tempfile
+
+CXX = os.environ.get('CXX', 'g++')
+CXXFLAGS = os.environ.get('CXXFLAGS', '-std=c++11 -O0').split()
+SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'concat.cpp')
+
+
+def compile_once(defines):
+    """Compile SOURCE in a fresh process; return (seconds, peak RSS in KiB)."""
+    with tempfile.TemporaryDirectory() as tmp:
+        cmd = [CXX] + CXXFLAGS + defines + ['-c', SOURCE, '-o', os.path.join(tmp, 'a.o')]
+        # ru_maxrss of RUSAGE_CHILDREN is the maximum over all children so far,
+        # so every measurement runs in its own python child
+        probe = ('import resource, subprocess, sys, time\n'
+                 'start = time.perf_counter()\n'
+                 'subprocess.run(sys.argv[1:], check=True)\n'
+                 'elapsed = time.perf_counter() - start\n'
+                 'print(elapsed, resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss)\n')
+        out = subprocess.run([sys.executable, '-c', probe] + cmd,
+                             check=True, stdout=subprocess.PIPE, universal_newlines=True).stdout
+        seconds, rss = out.split()
+        return float(seconds), int(rss)
+
+
+def main():
+    repeat = 3
+    for name, defines in (('operator+', []), ('concat', ['-DFROZEN_BENCH_USE_CONCAT'])):
+        runs = [compile_once(defines) for _ in range(repeat)]
+        seconds = min(r[0] for r in runs)
+        rss = min(r[1] for r in runs)
+        print('%-10s %8.2f s %10d KiB peak RSS' % (name, seconds, rss))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,324 @@
+#!/usr/bin/env python3
+"""Compile-time cost of frozen operations across input sizes.
+
+For every operation and size a translation unit is generated and compiled
+by each compiler; wall time and peak compiler memory are written as CSV,
+with the share of template instantiation and constant evaluation:
+
+    python3 bench/compile_time/suite.py -o compile_time.csv
+    python3 bench/compile_time/suite.py --compilers g++ clang++ --sizes 16 256 4096 --trace-dir traces
+    python3 bench/compile_time/suite.py --cxxflags='-std=c++20 -O0' --operations FROZEN_FROM_STRING_LITERAL meta::from
+
+Clang writes an -ftime-trace file per translation unit into --trace-dir (open
+it in chrome://tracing or Perfetto); GCC has no -ftime-trace, so its
+breakdown comes from -ftime-report.  A translation unit which does not
+compile, e.g. because a recursion limit is hit, is recorded with status
+"error" instead of stopping the run.  meta::from needs -std=c++20 or later
+and is skipped otherwise.
+"""
+
+import argparse
+import csv
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+ALPHABET = 'abcdefghijklmnopqrstuvwxyz'
+
+# FROZEN_FROM_STRING_LITERAL() reads at most BOOST_PP_LIMIT_REPEAT characters,
+# the terminating NUL included
+BOOST_PP_LIMIT_REPEAT = 256
+
+
+def text(n, last=None):
+    s = ''.join(ALPHABET[i % len(ALPHABET)] for i in range(n))
+    return s if last is None or n == 0 else s[:-1] + last
+
+
+# each generator returns the body of a translation unit for size n, or None
+# when the operation does not support n
+
+def operator_plus(n):
+    """an operator+ chain of 16 character literals, n characters in total"""
+    pieces = ' + '.join('"%s"' % text(16) for _ in range(max(n // 16, 1)))
+    return ('#include "frozen/string.hpp"\n'
+            'constexpr auto s = frozen::empty_str + %s;\n'
+            'static_assert(s.size() == %d, "");\n' % (pieces, max(n // 16, 1) * 16))
+
+
+def to_basic_string(n):
+    """n integers and n floating point numbers formatted"""
+    lines = ['#include "frozen/string.hpp"']
+    for i in range(n):
+        lines.append('constexpr auto i%d = frozen::to_string(%d);' % (i, i * 7919))
+        lines.append('constexpr auto f%d = frozen::to_string(%d.25);' % (i, i))
+    lines.append('static_assert(i%d.size() > 0 && f%d.size() > 0, "");' % (n - 1, n - 1))
+    return '\n'.join(lines) + '\n'
+
+
+def comparison(n):
+    """==, < and hash() of two n character strings which differ at the end"""
+    return ('#include "frozen/string.hpp"\n'
+            'constexpr auto a = frozen::make_string("%s");\n'
+            'constexpr auto b = frozen::make_string("%s");\n'
+            'static_assert(a < b && !(a == b) && a != b && a.hash() != b.hash(), "");\n'
+            % (text(n, '0'), text(n, '1')))
+
+
+def make_indices(n):
+    """detail::make_indices<0, n>"""
+    return ('#include "frozen/string.hpp"\n'
+            'typedef frozen::detail::make_indices<0, %d> type;\n'
+            'static_assert(type::value[%d] == %d, "");\n' % (n, n - 1, n - 1))
+
+
+def from_string_literal(n):
+    """the Boost.Preprocessor expansion of FROZEN_FROM_STRING_LITERAL() of an n character literal"""
+    if n + 1 > BOOST_PP_LIMIT_REPEAT:
+        return None
+    # FROZEN_FROM_STRING_LITERAL() is meta::from<> in C++20, the expansion is
+    # still there under its own name
+    return ('#include "frozen/meta/string.hpp"\n'
+            'typedef FROZEN_FROM_STRING_LITERAL_I("%s") type;\n'
+            'static_assert(!frozen::meta::empty<type>::value, "");\n' % text(n))
+
+
+def meta_from(n):
+    """frozen::meta::from<> of an n character literal (C++20)"""
+    return ('#include "frozen/meta/string.hpp"\n'
+            'typedef frozen::meta::from<"%s"> type;\n'
+            'static_assert(!frozen::meta::empty<type>::value, "");\n' % text(n))
+
+
+def meta_operations(n):
+    """concat, push_back, pop_front and remove_trailing_nuls of an n character meta::basic_string"""
+    chars = ', '.join("'%s'" % c for c in text(n))
+    return ('#include "frozen/meta/string_without_boost.hpp"\n'
+            'typedef frozen::meta::basic_string<char, %s> s;\n'
+            'typedef frozen::meta::concat<s, s> c;\n'
+            'typedef frozen::meta::pop_front<frozen::meta::push_back<c, \'!\'>> p;\n'
+            'typedef frozen::meta::remove_trailing_nuls<%d, frozen::meta::push_back<s, \'\\0\'>> r;\n'
+            'static_assert(std::is_same<r, s>::value && !frozen::meta::empty<p>::value, "");\n'
+            % (chars, n + 1))
+
+
+# the type-level algorithms of frozen/meta/string/operations.hpp and naive
+# versions of them which recurse once per character, as hand written code
+# does; both are applied to an n character string ending with '!'
+ALGORITHMS = {
+    'substr': ('frozen::meta::substr<s, %(half)d>',
+               'drop<%(half)d, s>::type',
+               """template<size_t N, class S> struct drop : drop<N - 1, frozen::meta::pop_front<S>> {};
+template<class S> struct drop<0, S> { typedef S type; };"""),
+    'find': ("frozen::meta::find<s, frozen::meta::basic_string<char, '!'>>",
+             'naive_find<s>',
+             """template<class S, size_t I = 0> struct naive_find;
+template<size_t I, char... T> struct naive_find<frozen::meta::basic_string<char, '!', T...>, I> : std::integral_constant<size_t, I> {};
+template<size_t I, char H, char... T> struct naive_find<frozen::meta::basic_string<char, H, T...>, I> : naive_find<frozen::meta::basic_string<char, T...>, I + 1> {};"""),
+    'count': ("frozen::meta::count<s, frozen::meta::basic_string<char, 'a'>>",
+              'naive_count<s>',
+              """template<class S> struct naive_count : std::integral_constant<size_t, 0> {};
+template<char H, char... T> struct naive_count<frozen::meta::basic_string<char, H, T...>>
+  : std::integral_constant<size_t, (H == 'a') + naive_count<frozen::meta::basic_string<char, T...>>::value> {};"""),
+    'replace_all': ("frozen::meta::replace_all<s, frozen::meta::basic_string<char, 'a'>, frozen::meta::basic_string<char, 'A', 'A'>>",
+                    'naive_replace<s>::type',
+                    """template<class S> struct naive_replace { typedef S type; };
+template<char H, char... T> struct naive_replace<frozen::meta::basic_string<char, H, T...>>
+  : std::conditional<H == 'a',
+                     frozen::meta::concat<frozen::meta::basic_string<char, 'A', 'A'>, typename naive_replace<frozen::meta::basic_string<char, T...>>::type>,
+                     frozen::meta::push_front<typename naive_replace<frozen::meta::basic_string<char, T...>>::type, H>> {};"""),
+    'split': ("frozen::meta::split<s, frozen::meta::basic_string<char, 'z'>>",
+              'naive_split<s>::type',
+              """template<class S, class Part = frozen::meta::basic_string<char>, class Parts = std::tuple<>> struct naive_split;
+template<class Part, class... Parts> struct naive_split<frozen::meta::basic_string<char>, Part, std::tuple<Parts...>> { typedef std::tuple<Parts..., Part> type; };
+template<char... T, class Part, class... Parts> struct naive_split<frozen::meta::basic_string<char, 'z', T...>, Part, std::tuple<Parts...>>
+  : naive_split<frozen::meta::basic_string<char, T...>, frozen::meta::basic_string<char>, std::tuple<Parts..., Part>> {};
+template<char H, char... T, class Part, class Parts> struct naive_split<frozen::meta::basic_string<char, H, T...>, Part, Parts>
+  : naive_split<frozen::meta::basic_string<char, T...>, frozen::meta::push_back<Part, H>, Parts> {};"""),
+    'reverse': ('frozen::meta::reverse<s>',
+                'naive_reverse<s>::type',
+                """template<class S, class Acc = frozen::meta::basic_string<char>> struct naive_reverse { typedef Acc type; };
+template<char H, char... T, char... A> struct naive_reverse<frozen::meta::basic_string<char, H, T...>, frozen::meta::basic_string<char, A...>>
+  : naive_reverse<frozen::meta::basic_string<char, T...>, frozen::meta::basic_string<char, H, A...>> {};"""),
+    'to_upper': ('frozen::meta::to_upper<s>',
+                 'naive_to_upper<s>::type',
+                 """template<class S> struct naive_to_upper { typedef S type; };
+template<char H, char... T> struct naive_to_upper<frozen::meta::basic_string<char, H, T...>>
+  : frozen::meta::push_front_<typename naive_to_upper<frozen::meta::basic_string<char, T...>>::type, (H >= 'a' && H <= 'z' ? H - 'a' + 'A' : H)> {};"""),
+}
+
+
+def meta_algorithm(name, naive):
+    fast, slow, definitions = ALGORITHMS[name]
+
+    def generate(n):
+        chars = ', '.join("'%s'" % c for c in text(n, '!'))
+        return ('#include <tuple>\n'
+                '#include <type_traits>\n'
+                '#include "frozen/meta/string_without_boost.hpp"\n'
+                'typedef frozen::meta::basic_string<char, %s> s;\n'
+                '%s\n'
+                'typedef %s result;\n'
+                'static_assert(sizeof(result) > 0, "");\n'
+                % (chars, definitions if naive else '', (slow if naive else fast) % {'half': n // 2}))
+    generate.__doc__ = '%s of an n character meta::basic_string%s' % (name, ', recursively' if naive else '')
+    return generate
+
+
+# the operations which need class type non-type template parameters
+CXX20_OPERATIONS = {'meta::from'}
+
+OPERATIONS = {
+    'operator+': operator_plus,
+    'to_basic_string': to_basic_string,
+    'comparison': comparison,
+    'make_indices': make_indices,
+    'FROZEN_FROM_STRING_LITERAL': from_string_literal,
+    'meta::from': meta_from,
+    'meta': meta_operations,
+}
+for name in ALGORITHMS:
+    OPERATIONS['meta::' + name] = meta_algorithm(name, False)
+    OPERATIONS['meta::' + name + ' (recursive)'] = meta_algorithm(name, True)
+
+
+def measure(cmd):
+    """Run cmd in a fresh process; return (succeeded, seconds, peak RSS in KiB, stderr)."""
+    # ru_maxrss of RUSAGE_CHILDREN is the maximum over all children so far,
+    # so every measurement runs in its own python child
+    probe = ('import resource, subprocess, sys, time\n'
+             'start = time.perf_counter()\n'
+             'p = subprocess.run(sys.argv[1:], stderr=subprocess.PIPE, universal_newlines=True)\n'
+             'elapsed = time.perf_counter() - start\n'
+             'sys.stderr.write(p.stderr)\n'
+             'print(p.returncode, elapsed, resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss)\n')
+    p = subprocess.run([sys.executable, '-c', probe] + cmd,
+                       stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+    status, seconds, rss = p.stdout.split()
+    return int(status) == 0, float(seconds), int(rss), p.stderr
+
+
+def is_clang(cxx):
+    out = subprocess.run([cxx, '--version'], stdout=subprocess.PIPE, universal_newlines=True).stdout
+    return 'clang' in out
+
+
+def gcc_breakdown(report):
+    """(template instantiation, constant expression evaluation) wall seconds of -ftime-report"""
+    def wall(phase):
+        for line in report.splitlines():
+            if line.strip().startswith(phase + ' '):
+                # usr, sys, wall and memory, each followed by its share in parentheses
+                figures = re.findall(r'([\d.]+)[kMG]?\s*\(', line)
+                return figures[2] if len(figures) >= 3 else ''
+        return ''
+    return wall('template instantiation'), wall('constant expression evaluation')
+
+
+def clang_breakdown(trace_file):
+    """(template instantiation, constant evaluation) seconds of an -ftime-trace file"""
+    with open(trace_file) as f:
+        events = json.load(f).get('traceEvents', [])
+    totals = {}
+    for e in events:
+        if e.get('name', '').startswith('Total '):
+            totals[e['name'][len('Total '):]] = e.get('dur', 0) / 1e6
+    instantiation = sum(v for k, v in totals.items() if k.startswith('Instantiate'))
+    evaluation = sum(v for k, v in totals.items() if k.startswith('Evaluate'))
+    return '%.3f' % instantiation, '%.3f' % evaluation
+
+
+def standard(cxxflags):
+    """the year of the last -std= flag, 2a and the like counted as their year"""
+    year = 98
+    for flag in cxxflags:
+        m = re.match(r'-std=(?:c|gnu)\+\+(\w\w)$', flag)
+        if m:
+            year = {'0x': 11, '1y': 14, '1z': 17, '2a': 20, '2b': 23, '2c': 26}.get(m.group(1)) or int(m.group(1))
+    return year if year > 90 else year + 2000
+
+
+def run(cxx, cxxflags, operation, n, repeat, trace_dir, tmp):
+    if operation in CXX20_OPERATIONS and standard(cxxflags) < 2020:
+        return None
+    source = OPERATIONS[operation](n)
+    if source is None:
+        return None
+    src = os.path.join(tmp, 'tu.cpp')
+    obj = os.path.join(tmp, 'tu.o')
+    with open(src, 'w') as f:
+        f.write(source)
+    cmd = [cxx] + cxxflags + ['-I', ROOT, '-c', src, '-o', obj]
+
+    runs = [measure(cmd) for _ in range(repeat)]
+    row = {
+        'compiler': os.path.basename(cxx),
+        'flags': ' '.join(cxxflags),
+        'operation': operation,
+        'size': n,
+        'status': 'ok' if all(r[0] for r in runs) else 'error',
+        'seconds': '%.3f' % min(r[1] for r in runs),
+        'peak_rss_kib': min(r[2] for r in runs),
+        'template_seconds': '',
+        'constexpr_seconds': '',
+        'trace': '',
+    }
+    if row['status'] != 'ok':
+        return row
+
+    # one more compilation for the breakdown, which the timing runs leave out
+    if is_clang(cxx):
+        measure(cmd + ['-ftime-trace'])
+        trace = os.path.splitext(obj)[0] + '.json'
+        if os.path.exists(trace):
+            row['template_seconds'], row['constexpr_seconds'] = clang_breakdown(trace)
+            if trace_dir:
+                name = '%s-%s-%d.json' % (row['compiler'], re.sub(r'\W', '_', operation), n)
+                shutil.copy(trace, os.path.join(trace_dir, name))
+                row['trace'] = os.path.join(trace_dir, name)
+    else:
+        report = measure(cmd + ['-ftime-report'])[3]
+        row['template_seconds'], row['constexpr_seconds'] = gcc_breakdown(report)
+    return row
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--compilers', nargs='+', default=['g++', 'clang++'])
+    parser.add_argument('--cxxflags', default='-std=c++14 -O0')
+    parser.add_argument('--sizes', nargs='+', type=int, default=[16, 64, 256, 1024, 4096])
+    parser.add_argument('--operations', nargs='+', choices=sorted(OPERATIONS), default=sorted(OPERATIONS))
+    parser.add_argument('--repeat', type=int, default=3, help='the minimum of REPEAT compilations is kept')
+    parser.add_argument('--trace-dir', help='where to keep the -ftime-trace files of clang')
+    parser.add_argument('-o', '--output', help='CSV file (default: stdout)')
+    args = parser.parse_args()
+
+    compilers = [c for c in args.compilers if shutil.which(c)]
+    for c in sorted(set(args.compilers) - set(compilers)):
+        sys.stderr.write('%s not found, skipped\n' % c)
+    if args.trace_dir:
+        os.makedirs(args.trace_dir, exist_ok=True)
+
+    out = open(args.output, 'w', newline='') if args.output else sys.stdout
+    writer = csv.DictWriter(out, fieldnames=['compiler', 'flags', 'operation', 'size', 'status', 'seconds',
+                                             'peak_rss_kib', 'template_seconds', 'constexpr_seconds', 'trace'])
+    writer.writeheader()
+    with tempfile.TemporaryDirectory() as tmp:
+        for cxx in compilers:
+            for operation in args.operations:
+                for n in args.sizes:
+                    row = run(cxx, args.cxxflags.split(), operation, n, args.repeat, args.trace_dir, tmp)
+                    if row is not None:
+                        writer.writerow(row)
+                        out.flush()
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
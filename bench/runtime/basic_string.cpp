@@ -0,0 +1,271 @@
+// Runtime cost of frozen::basic_string against std::string and
+// std::string_view, for char, char16_t and wchar_t and N = 8..4096:
+// construction from Char const*, operator==, operator<, size(), operator+,
+// to_std_string() and operator<<, and frozen::to_string() of integers and
+// floating point numbers against std::to_chars and std::to_string.
+//
+//   g++ -std=c++17 -O2 bench/runtime/basic_string.cpp && ./a.out > results.json
+//   ./a.out '==/char/'             # only the benchmarks whose name contains the filter
+//
+// The results are written to stdout in the JSON format of Google Benchmark,
+// so its tools/compare.py can compare two runs.  Every benchmark runs until it
+// has taken at least 0.1s.  std::to_string() of a floating point number
+// formats with "%f" while frozen::to_string() and std::to_chars write the
+// shortest representation, so the two are not doing the same work.
+
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "../../frozen/string.hpp"
+
+namespace {
+
+char const* filter = "";
+
+struct result{
+    std::string name;
+    std::size_t iterations;
+    double real_ns;
+    double cpu_ns;
+};
+
+std::string results;
+
+void report(result const& r)
+{
+    char line[512];
+    std::snprintf(line, sizeof(line),
+                  "%s    {\n"
+                  "      \"name\": \"%s\",\n"
+                  "      \"run_type\": \"iteration\",\n"
+                  "      \"iterations\": %zu,\n"
+                  "      \"real_time\": %.3f,\n"
+                  "      \"cpu_time\": %.3f,\n"
+                  "      \"time_unit\": \"ns\"\n"
+                  "    }",
+                  results.empty() ? "" : ",\n", r.name.c_str(), r.iterations, r.real_ns, r.cpu_ns);
+    results += line;
+}
+
+// run f until it has taken at least 0.1s; once a round takes 1ms the next
+// one is sized from it to last about 0.12s
+template<class F>
+void bench(std::string const& name, F f)
+{
+    if(name.find(filter) == std::string::npos){
+        return;
+    }
+    for(std::size_t iterations = 1; ; ){
+        std::clock_t const cpu_start = std::clock();
+        auto const start = std::chrono::steady_clock::now();
+        for(std::size_t i = 0; i < iterations; ++i){
+            f();
+        }
+        auto const end = std::chrono::steady_clock::now();
+        std::clock_t const cpu_end = std::clock();
+
+        double const real_ns = std::chrono::duration<double, std::nano>(end - start).count();
+        if(real_ns >= 1e8 || iterations >= 1000000000){
+            double const cpu_ns = 1e9 * (cpu_end - cpu_start) / CLOCKS_PER_SEC;
+            report({name, iterations, real_ns / iterations, cpu_ns / iterations});
+            return;
+        }
+        iterations = real_ns < 1e6 ? iterations * 10 : static_cast<std::size_t>(iterations * 1.2e8 / real_ns) + 1;
+    }
+}
+
+volatile std::size_t sink;
+
+// a stream buffer which drops what is written, so that operator<< is
+// measured without the growth of a std::ostringstream
+template<class Char>
+struct null_buffer : std::basic_streambuf<Char>{
+    typename std::basic_streambuf<Char>::int_type overflow(typename std::basic_streambuf<Char>::int_type c) override
+    {
+        return std::char_traits<Char>::not_eof(c);
+    }
+
+    std::streamsize xsputn(Char const*, std::streamsize n) override
+    {
+        return n;
+    }
+};
+
+template<class Char>
+struct char_name;
+
+template<>
+struct char_name<char>{
+    static constexpr char const* value = "char";
+};
+
+template<>
+struct char_name<char16_t>{
+    static constexpr char const* value = "char16_t";
+};
+
+template<>
+struct char_name<wchar_t>{
+    static constexpr char const* value = "wchar_t";
+};
+
+template<class Char>
+std::basic_string<Char> text(std::size_t n, char last)
+{
+    std::basic_string<Char> s;
+    for(std::size_t i = 0; i + 1 < n; ++i){
+        s += static_cast<Char>('a' + i % 26);
+    }
+    s += static_cast<Char>(last);
+    return s;
+}
+
+template<class Char, std::size_t N>
+void stream(std::string const& suffix, frozen::basic_string<Char, N+1> const* volatile pf,
+            std::basic_string<Char> const* volatile ps, std::basic_string_view<Char> const* volatile pv, std::true_type)
+{
+    null_buffer<Char> buffer;
+    std::basic_ostream<Char> os(&buffer);
+    bench("<</frozen" + suffix, [&]{ os << *pf; });
+    bench("<</std::string" + suffix, [&]{ os << *ps; });
+    bench("<</std::string_view" + suffix, [&]{ os << *pv; });
+}
+
+// frozen writes wide strings into std::wostream only, so not char16_t
+template<class Char, std::size_t N>
+void stream(std::string const&, frozen::basic_string<Char, N+1> const*,
+            std::basic_string<Char> const*, std::basic_string_view<Char> const*, std::false_type)
+{}
+
+template<class Char, std::size_t N>
+void run()
+{
+    std::string const suffix = std::string("/") + char_name<Char>::value + "/" + std::to_string(N);
+
+    // strings which differ at the end only: every character is compared
+    std::basic_string<Char> const str_lhs = text<Char>(N, 'x');
+    std::basic_string<Char> const str_rhs = text<Char>(N, 'y');
+    std::basic_string_view<Char> const sv_lhs = str_lhs;
+    std::basic_string_view<Char> const sv_rhs = str_rhs;
+    frozen::basic_string<Char, N+1> const fs_lhs = str_lhs.c_str();
+    frozen::basic_string<Char, N+1> const fs_rhs = str_rhs.c_str();
+
+    // read through volatile pointers, so that nothing is computed once
+    Char const* volatile pc = str_lhs.c_str();
+    std::basic_string<Char> const* volatile psl = &str_lhs;
+    std::basic_string<Char> const* volatile psr = &str_rhs;
+    std::basic_string_view<Char> const* volatile pvl = &sv_lhs;
+    std::basic_string_view<Char> const* volatile pvr = &sv_rhs;
+    frozen::basic_string<Char, N+1> const* volatile pfl = &fs_lhs;
+    frozen::basic_string<Char, N+1> const* volatile pfr = &fs_rhs;
+
+    bench("construct/frozen" + suffix, [&]{
+        frozen::basic_string<Char, N+1> const s = pc;
+        sink = s.size();
+    });
+    bench("construct/std::string" + suffix, [&]{
+        std::basic_string<Char> const s = pc;
+        sink = s.size();
+    });
+    bench("construct/std::string_view" + suffix, [&]{
+        std::basic_string_view<Char> const s = pc;
+        sink = s.size();
+    });
+
+    bench("==/frozen" + suffix, [&]{ sink = *pfl == *pfr; });
+    bench("==/std::string" + suffix, [&]{ sink = *psl == *psr; });
+    bench("==/std::string_view" + suffix, [&]{ sink = *pvl == *pvr; });
+
+    bench("</frozen" + suffix, [&]{ sink = *pfl < *pfr; });
+    bench("</std::string" + suffix, [&]{ sink = *psl < *psr; });
+    bench("</std::string_view" + suffix, [&]{ sink = *pvl < *pvr; });
+
+    bench("size/frozen" + suffix, [&]{ sink = pfl->size(); });
+    bench("size/std::string" + suffix, [&]{ sink = psl->size(); });
+    bench("size/std::string_view" + suffix, [&]{ sink = pvl->size(); });
+
+    bench("+/frozen" + suffix, [&]{
+        auto const s = *pfl + *pfr;
+        sink = s.size();
+    });
+    bench("+/std::string" + suffix, [&]{
+        std::basic_string<Char> const s = *psl + *psr;
+        sink = s.size();
+    });
+
+    bench("to_std_string/frozen" + suffix, [&]{ sink = pfl->to_std_string().size(); });
+    bench("to_std_string/std::string_view" + suffix, [&]{ sink = std::basic_string<Char>(*pvl).size(); });
+
+    stream<Char, N>(suffix, pfl, psl, pvl, std::integral_constant<bool, !std::is_same<Char, char16_t>::value>());
+}
+
+template<class T>
+void to_string(char const* name, T value)
+{
+    T const* volatile pv = &value;
+    std::string const suffix = std::string("/") + name;
+
+    bench("to_string/frozen" + suffix, [&]{ sink = frozen::to_string(*pv).size(); });
+    bench("to_string/std::to_chars" + suffix, [&]{
+        char buf[64];
+        sink = static_cast<std::size_t>(std::to_chars(buf, buf + sizeof(buf), *pv).ptr - buf);
+    });
+    bench("to_string/std::to_string" + suffix, [&]{ sink = std::to_string(*pv).size(); });
+}
+
+template<class Char>
+void run_lengths()
+{
+    run<Char, 8>();
+    run<Char, 64>();
+    run<Char, 512>();
+    run<Char, 4096>();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if(argc > 1){
+        filter = argv[1];
+    }
+
+    run_lengths<char>();
+    run_lengths<char16_t>();
+    run_lengths<wchar_t>();
+
+    to_string("int/7", 7);
+    to_string("int/-2147483647", -2147483647);
+    to_string("long_long/9223372036854775807", 9223372036854775807LL);
+    to_string("double/0.5", 0.5);
+    to_string("double/3.141592", 3.141592);
+    to_string("double/1234567.875", 1234567.875);
+
+    std::printf("{\n"
+                "  \"context\": {\n"
+                "    \"executable\": \"%s\",\n"
+                "    \"library_build_type\": \"%s\",\n"
+                "    \"cplusplus\": %ld\n"
+                "  },\n"
+                "  \"benchmarks\": [\n"
+                "%s\n"
+                "  ]\n"
+                "}\n",
+                argv[0],
+#ifdef NDEBUG
+                "release",
+#else
+                "debug",
+#endif
+                static_cast<long>(__cplusplus), results.c_str());
+    return 0;
+}
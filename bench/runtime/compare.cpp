@@ -0,0 +1,68 @@
+// Runtime cost of basic_string comparisons.
+//
+// Compares the dispatching operator==/operator< (memcmp and word-at-a-time
+// mismatch when not constant-evaluated) with the recursive constexpr
+// implementation called at runtime, for N = 16..4096.
+//
+//   g++ -std=c++11 -O2 bench/runtime/compare.cpp && ./a.out
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "../../frozen/string.hpp"
+
+namespace {
+
+template<class F>
+double ns_per_call(F f, std::size_t iterations)
+{
+    auto const start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < iterations; ++i){
+        f();
+    }
+    auto const end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+volatile bool sink;
+
+template<std::size_t N>
+void run()
+{
+    // equal strings are the worst case: every character is visited
+    std::string const src(N, 'x');
+    frozen::string<N+1> const lhs = src.c_str();
+    frozen::string<N+1> const rhs = src.c_str();
+    frozen::string<N+1> const* volatile pl = &lhs;
+    frozen::string<N+1> const* volatile pr = &rhs;
+
+    std::size_t const iterations = 4000000 / N + 1000;
+
+    double const eq_fast = ns_per_call([&]{ sink = *pl == *pr; }, iterations);
+    double const eq_rec = ns_per_call([&]{
+        sink = frozen::detail::impl::mismatch_impl(pl->data(), pr->data(), 0, pl->size()) == pl->size();
+    }, iterations);
+    double const lt_fast = ns_per_call([&]{ sink = *pl < *pr; }, iterations);
+    double const lt_rec = ns_per_call([&]{
+        sink = frozen::detail::compare_at(pl->data(), pl->size(), pr->data(), pr->size(),
+                   frozen::detail::impl::mismatch_impl(pl->data(), pr->data(), 0, pl->size())) < 0;
+    }, iterations);
+
+    std::printf("%6zu %12.1f %12.1f %8.1fx %12.1f %12.1f %8.1fx\n",
+                N, eq_rec, eq_fast, eq_rec / eq_fast, lt_rec, lt_fast, lt_rec / lt_fast);
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("%6s %12s %12s %9s %12s %12s %9s\n",
+                "N", "==(rec) ns", "==(fast) ns", "speedup", "<(rec) ns", "<(fast) ns", "speedup");
+    run<16>();
+    run<64>();
+    run<256>();
+    run<1024>();
+    run<4096>();
+    return 0;
+}
@@ -0,0 +1,92 @@
+// Runtime cost of frozen::regex against std::regex on log lines: a full
+// match of a date, a search for an IPv4 address, and a search which fails
+// on long lines.
+//
+//   g++ -std=c++17 -O2 bench/runtime/regex.cpp && ./a.out
+
+#include <chrono>
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "../../frozen/string.hpp"
+
+namespace {
+
+template<class F>
+double ns_per_line(F f, std::size_t lines, std::size_t iterations)
+{
+    auto const start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < iterations; ++i){
+        f();
+    }
+    auto const end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (iterations * lines);
+}
+
+volatile std::size_t sink;
+
+static constexpr auto date = frozen::make_string("\\d{4}-\\d{2}-\\d{2}");
+static constexpr auto ipv4 = frozen::make_string("(\\d{1,3}\\.){3}\\d{1,3}");
+static constexpr auto a_then_b = frozen::make_string("a.*b");
+
+} // namespace
+
+int main()
+{
+    std::vector<std::string> dates, lines;
+    for(int i = 0; i < 1000; ++i){
+        dates.push_back(i % 3 ? "2024-02-" + std::to_string(10 + i % 20) : "24-2-" + std::to_string(i % 30));
+        lines.push_back("GET /index.html from " + (i % 4 ? std::to_string(i % 256) + ".0.0." + std::to_string(i % 7) : std::string("localhost")) + " 200");
+    }
+    std::vector<std::string> const* volatile pd = &dates;
+    std::vector<std::string> const* volatile pl = &lines;
+    // every begin could start a match which never ends
+    std::vector<std::string> const long_lines(10, std::string(2000, 'a'));
+    std::vector<std::string> const* volatile pn = &long_lines;
+
+    std::regex const std_date(date.data());
+    std::regex const std_ipv4(ipv4.data());
+    std::regex const std_a_then_b(a_then_b.data());
+    std::size_t const iterations = 200;
+
+    double const frozen_match = ns_per_line([&]{
+        std::size_t n = 0;
+        for(auto const& s : *pd){ n += frozen::static_regex<date>.match(s); }
+        sink = n;
+    }, dates.size(), iterations);
+    double const std_match = ns_per_line([&]{
+        std::size_t n = 0;
+        for(auto const& s : *pd){ n += std::regex_match(s, std_date); }
+        sink = n;
+    }, dates.size(), iterations);
+    double const frozen_search = ns_per_line([&]{
+        std::size_t n = 0;
+        for(auto const& s : *pl){ n += frozen::static_regex<ipv4>.search(s).position; }
+        sink = n;
+    }, lines.size(), iterations);
+    double const std_search = ns_per_line([&]{
+        std::size_t n = 0;
+        std::smatch m;
+        for(auto const& s : *pl){ n += std::regex_search(s, m, std_ipv4) ? static_cast<std::size_t>(m.position(0)) : 0; }
+        sink = n;
+    }, lines.size(), iterations);
+
+    double const frozen_no_match = ns_per_line([&]{
+        std::size_t n = 0;
+        for(auto const& s : *pn){ n += static_cast<bool>(frozen::static_regex<a_then_b>.search(s)); }
+        sink = n;
+    }, long_lines.size(), 2);
+    double const std_no_match = ns_per_line([&]{
+        std::size_t n = 0;
+        for(auto const& s : *pn){ n += std::regex_search(s, std_a_then_b); }
+        sink = n;
+    }, long_lines.size(), 2);
+
+    std::printf("%-24s %12s %12s\n", "ns per line", "frozen", "std::regex");
+    std::printf("%-24s %12.1f %12.1f\n", "match date", frozen_match, std_match);
+    std::printf("%-24s %12.1f %12.1f\n", "search ipv4", frozen_search, std_search);
+    std::printf("%-24s %12.1f %12.1f\n", "search a.*b, no match", frozen_no_match, std_no_match);
+    return 0;
+}
@@ -0,0 +1,67 @@
+// Runtime cost of basic_string search members.
+//
+// Compares find/find_first_of (memchr and a character table when not
+// constant-evaluated) with the bisecting constexpr implementation called at
+// runtime and with std::string, for N = 16..4096.  The needle is at the end.
+//
+//   g++ -std=c++11 -O2 bench/runtime/search.cpp && ./a.out
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "../../frozen/string.hpp"
+
+namespace {
+
+template<class F>
+double ns_per_call(F f, std::size_t iterations)
+{
+    auto const start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < iterations; ++i){
+        f();
+    }
+    auto const end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+volatile std::size_t sink;
+
+template<std::size_t N>
+void run()
+{
+    std::string const src = std::string(N - 3, 'x') + "abc";
+    frozen::string<N+1> const hay = src.c_str();
+    frozen::string<N+1> const* volatile p = &hay;
+    std::string const* volatile ps = &src;
+
+    std::size_t const iterations = 4000000 / N + 1000;
+
+    double const find_fast = ns_per_call([&]{ sink = p->find("abc"); }, iterations);
+    double const find_rec = ns_per_call([&]{
+        sink = frozen::detail::impl::find_constexpr(p->data(), p->size(), "abc", 3, 0);
+    }, iterations);
+    double const find_std = ns_per_call([&]{ sink = ps->find("abc"); }, iterations);
+    double const of_fast = ns_per_call([&]{ sink = p->find_first_of("cba"); }, iterations);
+    double const of_rec = ns_per_call([&]{
+        sink = frozen::detail::impl::find_of_constexpr(p->data(), p->size(), "cba", 3, 0, true);
+    }, iterations);
+    double const of_std = ns_per_call([&]{ sink = ps->find_first_of("cba"); }, iterations);
+
+    std::printf("%6zu %12.1f %12.1f %12.1f %12.1f %12.1f %12.1f\n",
+                N, find_rec, find_fast, find_std, of_rec, of_fast, of_std);
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("%6s %12s %12s %12s %12s %12s %12s\n",
+                "N", "find(rec)", "find(fast)", "find(std)", "of(rec)", "of(fast)", "of(std)");
+    run<16>();
+    run<64>();
+    run<256>();
+    run<1024>();
+    run<4096>();
+    return 0;
+}
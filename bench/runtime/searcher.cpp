@@ -0,0 +1,63 @@
+// Runtime cost of frozen::searcher against std::string::find and the
+// C++17 std::boyer_moore_horspool_searcher, which builds its table on
+// every construction.  The haystack is 1MB of text without a match.
+//
+//   g++ -std=c++17 -O2 bench/runtime/searcher.cpp && ./a.out
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+#include "../../frozen/string.hpp"
+
+namespace {
+
+template<class F>
+double us_per_call(F f, std::size_t iterations)
+{
+    auto const start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < iterations; ++i){
+        f();
+    }
+    auto const end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+volatile std::size_t sink;
+
+template<std::size_t N>
+void run(std::string const& hay, frozen::string<N> const& needle)
+{
+    frozen::searcher<char, N> const s(needle);
+    std::string const std_needle = needle.to_std_string();
+    std::string const* volatile ph = &hay;
+
+    std::size_t const iterations = 200;
+
+    double const frozen_us = us_per_call([&]{ sink = s.find(*ph); }, iterations);
+    double const find_us = us_per_call([&]{ sink = ph->find(std_needle); }, iterations);
+    double const bmh_us = us_per_call([&]{
+        std::boyer_moore_horspool_searcher<std::string::const_iterator> const bmh(std_needle.begin(), std_needle.end());
+        sink = static_cast<std::size_t>(std::search(ph->begin(), ph->end(), bmh) - ph->begin());
+    }, iterations);
+
+    std::printf("%-40s %12.1f %12.1f %12.1f\n", std_needle.c_str(), frozen_us, find_us, bmh_us);
+}
+
+} // namespace
+
+int main()
+{
+    std::string hay;
+    while(hay.size() < (1 << 20)){
+        hay += "GET /index.html 200 lorem ipsum dolor sit amet ";
+    }
+
+    std::printf("%-40s %12s %12s %12s\n", "needle", "frozen us", "find us", "std bmh us");
+    run(hay, frozen::make_string("ERROR"));
+    run(hay, frozen::make_string("amet GET /index.html 500"));
+    run(hay, frozen::make_string("connection reset by peer while reading"));
+    return 0;
+}
@@ -1,6 +1,6 @@
 #include "../../frozen/string.hpp"
 
-constexpr frozen::string<10>
+constexpr frozen::string<11>
 fizzbuzz_value(int i)
 {
     return i % 15 == 0 ? "fizzbuzz" :
@@ -10,7 +10,7 @@ fizzbuzz_value(int i)
 }
 
 template<unsigned int I>
-constexpr frozen::string<I*11+1>
+constexpr frozen::string<I*12+1>
 fizzbuzz()
 {
     return fizzbuzz<I-1>() + fizzbuzz_value(I) + '\n';
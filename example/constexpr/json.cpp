@@ -9,15 +9,17 @@ static float constexpr crossover_percent = 50.0f;
 int main()
 {
     // make_string json at compile-time from config
-    auto constexpr json = frozen::empty_str +
-                  '{' +
-                      "\"random_tree_depth\" : " + random_tree_depth + ',' +
-                      "\"population_size\" : " + population_size + ',' +
-                      "\"mutation_percent\" : " + mutation_percent + ',' +
-                      "\"crossover_percent\" : " + crossover_percent + ',' +
-                  '}';
+    // FROZEN_SHRINK() drops the capacity reserved for escaping
+    auto constexpr json = FROZEN_SHRINK(frozen::json::object(
+                  frozen::json::member("random_tree_depth", random_tree_depth),
+                  frozen::json::member("population_size", population_size),
+                  frozen::json::member("mutation_percent", mutation_percent),
+                  frozen::json::member("crossover_percent", crossover_percent),
+                  frozen::json::member("note", "\"quoted\"\n")));
 
-    static_assert(json == "{\"random_tree_depth\" : 4,\"population_size\" : 100,\"mutation_percent\" : 5,\"crossover_percent\" : 50,}", "");
+    static_assert(json == "{\"random_tree_depth\":4,\"population_size\":100,\"mutation_percent\":5,\"crossover_percent\":50,\"note\":\"\\\"quoted\\\"\\n\"}", "");
+
+    static_assert(std::is_same<decltype(json), frozen::string<json.size()+1> const>::value, "");
 
     return 0;
 }
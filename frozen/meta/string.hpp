@@ -4,9 +4,11 @@
 #include "./string/basic_string.hpp"
 #include "./string/string_aliases.hpp"
 #include "./string/operations.hpp"
+#include "./string/from.hpp"
 #include "./string/from_literals.hpp"
 #include "./string/from_expression.hpp"
 #include "./string/to_string.hpp"
+#include "./string/symbol.hpp"
 #include "./string/boost/mpl_compatibility.hpp"
 
 #endif    // FROZEN_META_STRING_HPP_INCLUDED
@@ -8,6 +8,9 @@
 #include <iostream>
 #include <type_traits>
 #include <string>
+#if defined FROZEN_HAS_STRING_VIEW
+#   include <string_view>
+#endif
 
 namespace frozen {
 namespace meta {
@@ -19,24 +22,36 @@ struct basic_string{
     typedef CharT char_type;
     typedef basic_string<CharT, Chars...> type;
 
-    static const CharT value[sizeof...(Chars)+1];
-    static const std::array<CharT, sizeof...(Chars)+1> array;
-    static const frozen::basic_string<CharT, sizeof...(Chars)+1> frozen;
-    static std::string to_std_string()
+    // the only storage of the characters, NUL terminated.  Every
+    // translation unit shares it and the accessors below alias it or are
+    // evaluated at compile-time.
+    static constexpr CharT value[sizeof...(Chars)+1] = {Chars..., static_cast<CharT>('\0')};
+
+    static constexpr std::array<CharT, sizeof...(Chars)+1> array() noexcept
     {
-        return value;
+        return {{Chars..., static_cast<CharT>('\0')}};
     }
-};
 
-template< class CharT, CharT... Chars >
-const CharT basic_string<CharT, Chars...>::value[sizeof...(Chars)+1] = {Chars..., static_cast<CharT>('\0')};
+    static constexpr ::frozen::basic_string<CharT, sizeof...(Chars)+1> frozen() noexcept
+    {
+        return {{{Chars..., static_cast<CharT>('\0')}}};
+    }
 
-template< class CharT, CharT... Chars >
-std::array<CharT, sizeof...(Chars)+1> const basic_string<CharT, Chars...>::array = {{Chars..., static_cast<CharT>('\0')}};
+#if defined FROZEN_HAS_STRING_VIEW
+    static constexpr std::basic_string_view<CharT> view() noexcept
+    {
+        return {value, sizeof...(Chars)};
+    }
+#endif
 
-template< class CharT, CharT... Chars >
-frozen::basic_string<CharT, sizeof...(Chars)+1> const basic_string<CharT, Chars...>::frozen = {{{Chars..., static_cast<CharT>('\0')}}};
+    static std::basic_string<CharT> to_std_string()
+    {
+        return {value, sizeof...(Chars)};
+    }
+};
 
+template< class CharT, CharT... Chars >
+constexpr CharT basic_string<CharT, Chars...>::value[sizeof...(Chars)+1];
 
 } // namespace meta
 } // namespace frozen
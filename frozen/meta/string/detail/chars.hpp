@@ -0,0 +1,31 @@
+#if !defined FROZEN_META_STRING_DETAIL_CHARS_HPP_INCLUDED
+#define      FROZEN_META_STRING_DETAIL_CHARS_HPP_INCLUDED
+
+#include <cstddef>
+
+#include "../basic_string.hpp"
+
+namespace frozen {
+namespace meta {
+namespace detail {
+
+    // the number of characters of a basic_string and a pointer to them
+    template<class S>
+    struct chars_of;
+
+    template<class CharT, CharT... Chars>
+    struct chars_of< basic_string<CharT, Chars...> >{
+        static constexpr size_t size = sizeof...(Chars);
+        static constexpr CharT const* value = basic_string<CharT, Chars...>::value;
+    };
+
+    template<class CharT, CharT... Chars>
+    constexpr size_t chars_of< basic_string<CharT, Chars...> >::size;
+    template<class CharT, CharT... Chars>
+    constexpr CharT const* chars_of< basic_string<CharT, Chars...> >::value;
+
+} // namespace detail
+} // namespace meta
+} // namespace frozen
+
+#endif    // FROZEN_META_STRING_DETAIL_CHARS_HPP_INCLUDED
@@ -0,0 +1,77 @@
+#if !defined FROZEN_META_STRING_FROM_HPP_INCLUDED
+#define      FROZEN_META_STRING_FROM_HPP_INCLUDED
+
+#include <cstddef>
+
+#include "./basic_string.hpp"
+#include "../../string/detail/macros.hpp"
+#include "../../string/detail/indices.hpp"
+
+#if defined FROZEN_HAS_CLASS_TYPE_NTTP
+
+namespace frozen {
+namespace meta {
+
+namespace detail {
+
+    // structural copy of a string literal or of a constexpr
+    // frozen::basic_string, whose characters after size() are NULs
+    template<class CharT, size_t N>
+    struct fixed_string{
+        typedef CharT char_type;
+
+        CharT data[N];
+        size_t length;
+
+        constexpr fixed_string(CharT const (&str)[N])
+            : fixed_string(str, N - 1, frozen::detail::make_indices<0, N>())
+        {}
+
+        template<size_t M>
+        constexpr fixed_string(frozen::basic_string<CharT, M> const& s)
+            : fixed_string(s.data(), s.size(), frozen::detail::make_indices<0, N>())
+        {}
+
+        template<size_t... Indices>
+        constexpr fixed_string(CharT const* str, size_t n, frozen::detail::indices<Indices...>)
+            : data{str[Indices]...}, length(n)
+        {}
+
+        constexpr CharT operator[](size_t idx) const
+        {
+            return data[idx];
+        }
+    };
+
+    template<class CharT, size_t N>
+    fixed_string(CharT const (&)[N]) -> fixed_string<CharT, N>;
+
+    template<class CharT, size_t N>
+    fixed_string(frozen::basic_string<CharT, N> const&) -> fixed_string<CharT, frozen::basic_string<CharT, N>::len>;
+
+} // namespace detail
+
+// from {{{
+template<detail::fixed_string Str, class Indices = frozen::detail::make_indices<0, Str.length>>
+struct from_;
+
+template<detail::fixed_string Str, size_t... Indices>
+struct from_<Str, frozen::detail::indices<Indices...>>
+  : basic_string<typename decltype(Str)::char_type, Str[Indices]...>
+{};
+
+// The type of a string literal or of a constexpr frozen::basic_string,
+// without Boost and without a limit on the length.
+//
+//   frozen::meta::from<"hoge">                        // basic_string<char, 'h', 'o', 'g', 'e'>
+//   frozen::meta::from<frozen::to_string(42)>         // basic_string<char, '4', '2'>
+template<detail::fixed_string Str>
+using from = typename from_<Str>::type;
+// }}}
+
+} // namespace meta
+} // namespace frozen
+
+#endif
+
+#endif    // FROZEN_META_STRING_FROM_HPP_INCLUDED
@@ -5,7 +5,9 @@
 
 #include "./basic_string.hpp"
 #include "./operations.hpp"
+#include "./from.hpp"
 
+#include <boost/preprocessor/cat.hpp>
 #include <boost/preprocessor/repetition/enum.hpp>
 #include <boost/preprocessor/facilities/intercept.hpp>
 #include <boost/preprocessor/config/limits.hpp>
@@ -33,7 +35,14 @@ namespace detail {
 } // namespace frozen
 
 
+// with class type non-type template parameters the characters are taken
+// by frozen::meta::from<> instead of BOOST_PP_LIMIT_REPEAT subscripts, so
+// that the literal can be of any length
+#if defined FROZEN_HAS_CLASS_TYPE_NTTP
+#define FROZEN_FROM_STRING_LITERAL(lit) frozen::meta::from<(lit)>
+#else
 #define FROZEN_FROM_STRING_LITERAL(lit) FROZEN_FROM_STRING_LITERAL_I(lit)
+#endif
 #define FROZEN_FROM_STRING_LITERAL_I(lit) \
     frozen::meta::remove_trailing_nuls< \
         sizeof(lit) / sizeof(*lit), \
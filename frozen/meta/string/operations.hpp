@@ -1,8 +1,14 @@
 #if !defined FROZEN_META_STRING_ALGORITHM_HPP_INCLUDED
 #define      FROZEN_META_STRING_ALGORITHM_HPP_INCLUDED
 
+#include <cstddef>
+#include <tuple>
 #include <type_traits>
 #include "./basic_string.hpp"
+#include "./detail/chars.hpp"
+#include "../../string/detail/macros.hpp"
+#include "../../string/detail/indices.hpp"
+#include "../../string/detail/search.hpp"
 
 namespace frozen {
 namespace meta {
@@ -136,23 +142,305 @@ template<class S>
 using empty = typename empty_<S>::type;
 // }}}
 
-// remove_trailing_nuls {{{
-template<size_t N, class T>
-struct remove_trailing_nuls_;
+// The algorithms below take the characters of a string by index from
+// detail::chars_of<S>::value and expand an index pack of
+// frozen::detail::make_indices, so their instantiation depth is O(log N)
+// instead of one level per character.  The positions are computed by
+// constexpr functions which bisect, or loop with relaxed constexpr.
+// The specializations take S as a whole rather than as
+// basic_string<CharT, Chars...>: naming the pack in every element of the
+// expansion makes the compiler rebuild the argument list once per
+// character, which is quadratic.
+
+using frozen::detail::npos;
+
+namespace detail {
+
+    template<class CharT>
+    constexpr CharT to_upper(CharT c)
+    {
+        return c >= 'a' && c <= 'z' ? static_cast<CharT>(c - 'a' + 'A') : c;
+    }
+
+    template<class CharT>
+    constexpr CharT to_lower(CharT c)
+    {
+        return c >= 'A' && c <= 'Z' ? static_cast<CharT>(c - 'A' + 'a') : c;
+    }
+
+    // the first occurrence of Needle in S at or after pos, or npos
+    template<class S, class Needle>
+    constexpr size_t find_from(size_t pos)
+    {
+        return frozen::detail::find(chars_of<S>::value, chars_of<S>::size, chars_of<Needle>::value, chars_of<Needle>::size, pos);
+    }
+
+    // the occurrences of Needle in S which do not overlap, from the left:
+    // their number and their positions followed by the size of S
+    template<size_t N>
+    struct positions{
+        size_t data[N];
+
+        constexpr size_t operator[](size_t idx) const
+        {
+            return data[idx];
+        }
+    };
+
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+    template<class S, class Needle>
+    constexpr size_t count_occurrences()
+    {
+        size_t n = 0;
+        for(size_t pos = find_from<S, Needle>(0); pos != npos; pos = find_from<S, Needle>(pos + chars_of<Needle>::size)){
+            ++n;
+        }
+        return n;
+    }
+
+    template<class S, class Needle, size_t N>
+    constexpr positions<N + 1> occurrences()
+    {
+        positions<N + 1> r{};
+        size_t pos = 0;
+        for(size_t i = 0; i < N; ++i){
+            pos = find_from<S, Needle>(pos);
+            r.data[i] = pos;
+            pos += chars_of<Needle>::size;
+        }
+        r.data[N] = chars_of<S>::size;
+        return r;
+    }
+#else
+    // the recursion depth is the number of occurrences
+    template<class S, class Needle>
+    constexpr size_t count_occurrences_from(size_t pos)
+    {
+        return pos == npos ? 0 : 1 + count_occurrences_from<S, Needle>(find_from<S, Needle>(pos + chars_of<Needle>::size));
+    }
+
+    template<class S, class Needle>
+    constexpr size_t count_occurrences()
+    {
+        return count_occurrences_from<S, Needle>(find_from<S, Needle>(0));
+    }
+
+    template<class S, class Needle>
+    constexpr size_t nth_occurrence(size_t n)
+    {
+        return find_from<S, Needle>(n == 0 ? 0 : nth_occurrence<S, Needle>(n - 1) + chars_of<Needle>::size);
+    }
+
+    template<class S, class Needle, class Indices>
+    struct nth_occurrences;
+
+    template<class S, class Needle, size_t... Indices>
+    struct nth_occurrences< S, Needle, frozen::detail::indices<Indices...> >{
+        static constexpr positions<sizeof...(Indices) + 1> value()
+        {
+            return {{nth_occurrence<S, Needle>(Indices)..., chars_of<S>::size}};
+        }
+    };
+
+    template<class S, class Needle, size_t N>
+    constexpr positions<N + 1> occurrences()
+    {
+        return nth_occurrences<S, Needle, frozen::detail::make_indices<0, N>>::value();
+    }
+#endif
+
+    template<class S, class Needle>
+    struct occurrences_of_{
+        static_assert(chars_of<Needle>::size > 0, "frozen::meta: the string to look for must not be empty");
+
+        // an empty Needle would be found everywhere, so only the static_assert is reported
+        static constexpr size_t count = chars_of<Needle>::size == 0 ? 0 : count_occurrences<S, Needle>();
+        static constexpr positions<count + 1> value = occurrences<S, Needle, count>();
+    };
+
+    template<class S, class Needle>
+    constexpr size_t occurrences_of_<S, Needle>::count;
+    template<class S, class Needle>
+    constexpr positions<occurrences_of_<S, Needle>::count + 1> occurrences_of_<S, Needle>::value;
+
+    // where the replacement of the n-th occurrence begins in the result of replace_all
+    template<class S, class From, class To>
+    constexpr size_t replaced_at(size_t n)
+    {
+        return occurrences_of_<S, From>::value[n] + n * chars_of<To>::size - n * chars_of<From>::size;
+    }
+
+    // the number of replacements which begin at or before idx in the result,
+    // by bisecting [first, last)
+    template<class S, class From, class To>
+    constexpr size_t replacements_before(size_t idx, size_t first, size_t last)
+    {
+        return first == last ? first :
+               replaced_at<S, From, To>(first + (last-first)/2) <= idx ?
+                   replacements_before<S, From, To>(idx, first + (last-first)/2 + 1, last) :
+                   replacements_before<S, From, To>(idx, first, first + (last-first)/2);
+    }
+
+    template<class S, class From, class To>
+    constexpr typename S::char_type replaced_char(size_t idx, size_t n)
+    {
+        return n == 0 ? chars_of<S>::value[idx] :
+               idx - replaced_at<S, From, To>(n - 1) < chars_of<To>::size ?
+                   chars_of<To>::value[idx - replaced_at<S, From, To>(n - 1)] :
+                   chars_of<S>::value[idx - replaced_at<S, From, To>(n - 1) - chars_of<To>::size + occurrences_of_<S, From>::value[n - 1] + chars_of<From>::size];
+    }
+
+    // the character at idx in the result of replace_all
+    template<class S, class From, class To>
+    constexpr typename S::char_type replaced_char(size_t idx)
+    {
+        return replaced_char<S, From, To>(idx, replacements_before<S, From, To>(idx, 0, occurrences_of_<S, From>::count));
+    }
+
+} // namespace detail
+
+
+// substr {{{
+template<class S, size_t Pos, size_t Count = npos,
+         class Indices = frozen::detail::make_indices<
+             Pos,
+             // clamped so that an out of range Pos reaches the static_assert
+             Pos <= detail::chars_of<S>::size ?
+                 Pos + (Count < detail::chars_of<S>::size - Pos ? Count : detail::chars_of<S>::size - Pos) :
+                 Pos
+         >>
+struct substr_;
+
+template<class S, size_t Pos, size_t Count, size_t... Indices>
+struct substr_< S, Pos, Count, frozen::detail::indices<Indices...> >
+  : basic_string<typename S::char_type, detail::chars_of<S>::value[Indices]...>
+{
+    static_assert(Pos <= detail::chars_of<S>::size, "frozen::meta::substr: Pos is out of range");
+};
 
-template<class CharT, CharT Head, CharT... Tail>
-struct remove_trailing_nuls_<1, basic_string<CharT, Head, Tail...>>
-  : basic_string<CharT>
+// [Pos, Pos+Count) of S, or [Pos, size) if S is shorter
+template<class S, size_t Pos, size_t Count = npos>
+using substr = typename substr_<S, Pos, Count>::type;
+// }}}
+
+
+// find {{{
+template<class S, class Needle, size_t Pos = 0>
+struct find_
+  : std::integral_constant<size_t, detail::find_from<S, Needle>(Pos)>
+{};
+
+// the first index at or after Pos where Needle begins in S, or npos
+template<class S, class Needle, size_t Pos = 0>
+using find = typename find_<S, Needle, Pos>::type;
+// }}}
+
+
+// count {{{
+template<class S, class Needle>
+struct count_
+  : std::integral_constant<size_t, detail::occurrences_of_<S, Needle>::count>
+{};
+
+// the number of occurrences of Needle in S which do not overlap
+template<class S, class Needle>
+using count = typename count_<S, Needle>::type;
+// }}}
+
+
+// replace_all {{{
+template<class S, class From, class To,
+         class Indices = frozen::detail::make_indices<
+             0,
+             detail::chars_of<S>::size + detail::occurrences_of_<S, From>::count * detail::chars_of<To>::size
+                                       - detail::occurrences_of_<S, From>::count * detail::chars_of<From>::size
+         >>
+struct replace_all_;
+
+template<class S, class From, class To, size_t... Indices>
+struct replace_all_< S, From, To, frozen::detail::indices<Indices...> >
+  : basic_string<typename S::char_type, detail::replaced_char<S, From, To>(Indices)...>
+{};
+
+// S with every occurrence of From replaced by To, from the left
+template<class S, class From, class To>
+using replace_all = typename replace_all_<S, From, To>::type;
+// }}}
+
+
+// split {{{
+template<class S, class Separator,
+         class Indices = frozen::detail::make_indices<0, detail::occurrences_of_<S, Separator>::count + 1>>
+struct split_;
+
+template<class S, class Separator, size_t... Indices>
+struct split_< S, Separator, frozen::detail::indices<Indices...> >{
+    typedef std::tuple<
+        substr<
+            S,
+            (Indices == 0 ? 0 : detail::occurrences_of_<S, Separator>::value[Indices - 1] + detail::chars_of<Separator>::size),
+            detail::occurrences_of_<S, Separator>::value[Indices]
+                - (Indices == 0 ? 0 : detail::occurrences_of_<S, Separator>::value[Indices - 1] + detail::chars_of<Separator>::size)
+        >...
+    > type;
+};
+
+// the parts of S between the occurrences of Separator, as a std::tuple
+// of basic_string; there is one more part than there are separators
+template<class S, class Separator>
+using split = typename split_<S, Separator>::type;
+// }}}
+
+
+// reverse {{{
+template<class S, class Indices = frozen::detail::make_indices<0, detail::chars_of<S>::size>>
+struct reverse_;
+
+template<class S, size_t... Indices>
+struct reverse_< S, frozen::detail::indices<Indices...> >
+  : basic_string<typename S::char_type, detail::chars_of<S>::value[sizeof...(Indices) - 1 - Indices]...>
 {};
 
-template<class CharT, size_t N, CharT Head, CharT... Tail>
-struct remove_trailing_nuls_<N, basic_string<CharT, Head, Tail...>>
-  : push_front<typename remove_trailing_nuls_<N-1, basic_string<CharT, Tail...>>::type, Head>
+template<class S>
+using reverse = typename reverse_<S>::type;
+// }}}
+
+
+// to_upper, to_lower {{{
+template<class S>
+struct to_upper_;
+
+template<class CharT, CharT... Chars>
+struct to_upper_< basic_string<CharT, Chars...> >
+  : basic_string<CharT, detail::to_upper(Chars)...>
 {};
 
+// ASCII letters only
+template<class S>
+using to_upper = typename to_upper_<S>::type;
+
+template<class S>
+struct to_lower_;
+
+template<class CharT, CharT... Chars>
+struct to_lower_< basic_string<CharT, Chars...> >
+  : basic_string<CharT, detail::to_lower(Chars)...>
+{};
+
+template<class S>
+using to_lower = typename to_lower_<S>::type;
+// }}}
+
+
+// remove_trailing_nuls {{{
 template<size_t N, class T>
-using remove_trailing_nuls = typename remove_trailing_nuls_<N, T>::type;
+struct remove_trailing_nuls_
+  : substr_<T, 0, N - 1>
+{};
 
+// the first N-1 characters of T, which FROZEN_FROM_STRING_LITERAL() pads with NULs
+template<size_t N, class T>
+using remove_trailing_nuls = typename remove_trailing_nuls_<N, T>::type;
 // }}}
 
 } // namespace meta
@@ -0,0 +1,124 @@
+#if !defined FROZEN_META_STRING_SYMBOL_HPP_INCLUDED
+#define      FROZEN_META_STRING_SYMBOL_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include "./basic_string.hpp"
+#include "./detail/chars.hpp"
+#include "../../string/detail/macros.hpp"
+#include "../../string/detail/hash.hpp"
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+#   include "../../string/detail/string_like.hpp"
+#   include "../../string/detail/label_table.hpp"
+#endif
+
+namespace frozen {
+namespace meta {
+
+namespace detail {
+
+    // the number of Symbols which are S
+    template<class S, class... Symbols>
+    struct symbol_count;
+
+    template<class S>
+    struct symbol_count<S> : std::integral_constant<size_t, 0>
+    {};
+
+    template<class S, class Head, class... Tail>
+    struct symbol_count<S, Head, Tail...>
+        : std::integral_constant<size_t, std::is_same<S, Head>::value + symbol_count<S, Tail...>::value>
+    {};
+
+    // the index of S in Symbols, or sizeof...(Symbols)
+    template<class S, class... Symbols>
+    struct symbol_index;
+
+    template<class S>
+    struct symbol_index<S> : std::integral_constant<size_t, 0>
+    {};
+
+    template<class S, class... Tail>
+    struct symbol_index<S, S, Tail...> : std::integral_constant<size_t, 0>
+    {};
+
+    template<class S, class Head, class... Tail>
+    struct symbol_index<S, Head, Tail...>
+        : std::integral_constant<size_t, 1 + symbol_index<S, Tail...>::value>
+    {};
+
+    template<class... Symbols>
+    struct symbols_distinct : std::true_type
+    {};
+
+    template<class Head, class... Tail>
+    struct symbols_distinct<Head, Tail...>
+        : std::integral_constant<bool, symbol_count<Head, Tail...>::value == 0 && symbols_distinct<Tail...>::value>
+    {};
+
+} // namespace detail
+
+// 64bit FNV-1a of a symbol, the same value as frozen::basic_string::hash()
+template<class S>
+struct symbol_hash
+    : std::integral_constant<std::uint64_t, frozen::detail::fnv1a(detail::chars_of<S>::value, detail::chars_of<S>::size)>
+{};
+
+// The universe of the symbols of a program: each one gets a dense id in
+// [0, size) by its position, so symbols compare as integers and tables keyed
+// by symbols are plain arrays.
+//
+//   typedef frozen::meta::symbol_table<S("orders"), S("trades")> topics;
+//   topics::id<S("trades")>::value;    // 1
+//   topics::intern(name);              // 1 if name is "trades", topics::unknown if no topic (C++14)
+template<class... Symbols>
+struct symbol_table;
+
+template<class S, class Table>
+struct symbol_id;
+
+template<class S, class... Symbols>
+struct symbol_id< S, symbol_table<Symbols...> >
+    : std::integral_constant<size_t, detail::symbol_index<S, Symbols...>::value>
+{
+    static_assert(detail::symbol_count<S, Symbols...>::value == 1, "frozen::meta::symbol_id: not a symbol of the table");
+};
+
+template<class... Symbols>
+struct symbol_table{
+    FROZEN_STATIC_ASSERT(sizeof...(Symbols) > 0);
+    static_assert(detail::symbols_distinct<Symbols...>::value, "frozen::meta::symbol_table: the symbols must be distinct");
+
+    typedef typename std::tuple_element<0, std::tuple<Symbols...>>::type::char_type char_type;
+
+    static constexpr size_t size = sizeof...(Symbols);
+
+    // what intern() returns for a string which is not a symbol
+    static constexpr size_t unknown = size;
+
+    template<class S>
+    using id = symbol_id<S, symbol_table>;
+
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+    // @brief: the id of the symbol equal to s, or unknown.  One perfect hash
+    //         lookup and one comparison.
+    template<class String>
+    static constexpr size_t intern(String const& s)
+    {
+        return frozen::detail::label_table<char_type, Symbols...>::find(frozen::detail::data_of(s), frozen::detail::size_of(s));
+    }
+#endif
+};
+
+template<class... Symbols>
+constexpr size_t symbol_table<Symbols...>::size;
+template<class... Symbols>
+constexpr size_t symbol_table<Symbols...>::unknown;
+
+} // namespace meta
+} // namespace frozen
+
+#endif    // FROZEN_META_STRING_SYMBOL_HPP_INCLUDED
@@ -4,6 +4,8 @@
 #include "./string/basic_string.hpp"
 #include "./string/string_aliases.hpp"
 #include "./string/operations.hpp"
+#include "./string/from.hpp"
 #include "./string/to_string.hpp"
+#include "./string/symbol.hpp"
 
 #endif    // FROZEN_META_STRING_WITHOUT_BOOST_HPP_INCLUDED
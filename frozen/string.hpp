@@ -5,7 +5,21 @@
 #include "./string/string_aliases.hpp"
 #include "./string/make.hpp"
 #include "./string/to_string.hpp"
+#include "./string/from_string.hpp"
 #include "./string/empty.hpp"
 #include "./string/literal.hpp"
+#include "./string/hash.hpp"
+#include "./string/shrink.hpp"
+#include "./string/concat.hpp"
+#include "./string/json.hpp"
+#include "./string/searcher.hpp"
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+#   include "./string/map.hpp"
+#   include "./string/set.hpp"
+#   include "./string/sorted_set.hpp"
+#   include "./string/multi_matcher.hpp"
+#   include "./string/regex.hpp"
+#   include "./string/string_switch.hpp"
+#endif
 
 #endif    // FROZEN_STRING_HPP_INCLUDED
@@ -2,6 +2,7 @@
 #define      FROZEN_STRING_BASIC_STRING_HPP_INCLUDED
 
 #include <cstddef>
+#include <cstdint>
 #include <stdexcept>
 #include <ostream>
 #include <string>
@@ -12,6 +13,9 @@
 #include "./detail/indices.hpp"
 #include "./detail/array_wrapper.hpp"
 #include "./detail/strlen.hpp"
+#include "./detail/compare.hpp"
+#include "./detail/search.hpp"
+#include "./detail/hash.hpp"
 #include "../type_traits_aliases.hpp"
 #include "./to_string.hpp"
 
@@ -38,6 +42,19 @@ inline constexpr bool operator!=(Char const (&lhs)[M], basic_string<Char, N> con
 
 namespace detail {
 
+    // the index packs which the characters are copied with; relaxed
+    // constexpr copies them with loops and needs none
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+    template<size_t N>
+    struct copy_loop{};
+
+    template<size_t N>
+    using copy_indices = copy_loop<N>;
+#else
+    template<size_t N>
+    using copy_indices = make_indices<0, N>;
+#endif
+
     template<class Char, size_t M, size_t N>
     class operator_plus_impl{
         size_t const size_lhs;
@@ -47,10 +64,25 @@ namespace detail {
         constexpr operator_plus_impl(size_t sl, size_t sr)
             : size_lhs(sl), size_rhs(sr) {}
 
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+        template<class ArrayL, class ArrayR>
+        constexpr basic_string<Char, M+N> operator()(ArrayL const& lhs, ArrayR const& rhs, detail::copy_loop<M>, detail::copy_loop<N>) const
+        {
+            array_wrapper<Char, M+N> r{};
+            for(size_t i = 0; i < size_lhs; ++i){
+                r.data[i] = lhs[i];
+            }
+            for(size_t i = 0; i < size_rhs; ++i){
+                r.data[size_lhs + i] = rhs[i];
+            }
+            return basic_string<Char, M+N>(r, size_lhs + size_rhs);
+        }
+#else
         template<class ArrayL, class ArrayR, size_t... IndicesL, size_t... IndicesR>
         constexpr basic_string<Char, M+N> operator()(ArrayL const& lhs, ArrayR const& rhs, detail::indices<IndicesL...>, detail::indices<IndicesR...>) const
         {
-            return {{{
+            // the length of the result is already known, so it is not scanned again
+            return basic_string<Char, M+N>({{
                         ( IndicesL < size_lhs ? lhs[IndicesL] :
                           IndicesL < size_lhs + size_rhs ? rhs[IndicesL - size_lhs] :
                           '\0'
@@ -59,33 +91,24 @@ namespace detail {
                             rhs[IndicesR + (M - size_lhs)] :
                             '\0'
                         )...
-                   }}};
+                   }}, size_lhs + size_rhs);
         }
+#endif
     };
 
 } // namespace detail
 template<class Char, size_t M, size_t N, size_t rlen = basic_string<Char, N>::len>
 inline constexpr basic_string<Char, M+rlen> operator+(Char const (&lhs)[M], basic_string<Char, N> const& rhs)
 {
-    return detail::operator_plus_impl<Char, M, rlen>(detail::strlen(lhs), detail::strlen(rhs))(lhs, rhs, detail::make_indices<0, M>(), detail::make_indices<0, rlen>());
+    return detail::operator_plus_impl<Char, M, rlen>(detail::strlen(lhs), rhs.size())(lhs, rhs, detail::copy_indices<M>(), detail::copy_indices<rlen>());
 }
 
-namespace detail {
-
-    template<class Char, size_t N, size_t... IndicesR>
-    inline constexpr basic_string<Char, N+1> operator_plus_char_impl(Char lhs, basic_string<Char, N> const& rhs, detail::indices<IndicesR...>)
-    {
-        return {{{lhs, rhs[IndicesR]...}}};
-    }
-
-} // namespace detail
-
 template<class Char, size_t N,
          size_t rlen = basic_string<Char, N>::len,
          class = alias::enable_if<detail::check_char<Char>::value>>
 inline constexpr basic_string<Char, rlen+1> operator+(Char lhs, basic_string<Char, N> const& rhs)
 {
-    return detail::operator_plus_char_impl(lhs, rhs, detail::make_indices<0, rlen>());
+    return detail::operator_plus_impl<Char, 1, rlen>(1, rhs.size())(detail::array_wrapper<Char, 1>{{lhs}}, rhs, detail::copy_indices<1>(), detail::copy_indices<rlen>());
 }
 
 template<class Num, class Char, size_t N,
@@ -159,28 +182,29 @@ public:
     typedef basic_string<Char, N> self_type;
 
     static constexpr size_type len = N ? N : 1;
+    static constexpr size_type npos = detail::npos;
 
     // ctor definitions
     basic_string() = default;
 
     template<size_t M, class = alias::enable_if<M <= len>>
     constexpr basic_string(Char const (&str)[M])
-        : basic_string(str, detail::make_indices<0, len>())
+        : basic_string(str, detail::copy_indices<len>())
     {}
 
     constexpr basic_string(Char const *str)
-        : basic_string(str, detail::strlen(str, len), detail::make_indices<0, len>())
+        : basic_string(str, detail::strlen(str, len), detail::copy_indices<len>())
     {}
 
     // implicit conversion from <braced initializer list> to array_wrapper is expected
     constexpr basic_string(detail::array_wrapper<Char, len> aw)
-        : elems(aw)
+        : elems(aw), length(detail::strnlen(aw, len))
     {}
 
     // implicit conversion from shorter string
     template<size_t M>
     constexpr basic_string(basic_string<Char, M> const& lhs)
-        : basic_string(lhs, detail::make_indices<0, len>())
+        : basic_string(lhs, detail::copy_indices<len>())
     {
         FROZEN_STATIC_ASSERT(N>=M);
     }
@@ -234,12 +258,12 @@ public:
 
     constexpr bool empty() const noexcept
     {
-        return front()=='\0';
+        return length == 0;
     }
 
     constexpr size_type size() const noexcept
     {
-        return size_impl(0);
+        return length;
     }
 
     // operators
@@ -251,19 +275,19 @@ public:
     template<size_t M, size_t rlen = basic_string<Char, M>::len>
     constexpr basic_string<Char, len+rlen> operator+(basic_string<Char, M> const& rhs) const
     {
-        return detail::operator_plus_impl<Char, len, rlen>(detail::strlen(elems, len), detail::strlen(rhs))(elems, rhs, detail::make_indices<0, len>(), detail::make_indices<0, rlen>());
+        return detail::operator_plus_impl<Char, len, rlen>(length, rhs.size())(elems, rhs, detail::copy_indices<len>(), detail::copy_indices<rlen>());
     }
 
     template<size_t M>
     constexpr basic_string<Char, len+M> operator+(Char const (&rhs)[M]) const
     {
-        return detail::operator_plus_impl<Char, len, M>(detail::strlen(elems), detail::strlen(rhs))(elems, rhs, detail::make_indices<0, len>(), detail::make_indices<0, M>());
+        return detail::operator_plus_impl<Char, len, M>(length, detail::strlen(rhs))(elems, rhs, detail::copy_indices<len>(), detail::copy_indices<M>());
     }
 
     template<class C, class = alias::enable_if<detail::check_char<C>::value>>
-    constexpr basic_string<Char, N+1> operator+(C rhs) const
+    constexpr basic_string<Char, len+1> operator+(C rhs) const
     {
-        return operator_plus_char_impl(rhs, detail::strlen(elems), detail::make_indices<0, len>());
+        return detail::operator_plus_impl<Char, len, 1>(length, 1)(elems, detail::array_wrapper<Char, 1>{{static_cast<Char>(rhs)}}, detail::copy_indices<len>(), detail::copy_indices<1>());
     }
 
     template<class Num,
@@ -279,18 +303,16 @@ public:
         return operator+(to_basic_string<Char>(n));
     }
 
-    template<size_t M, size_t rlen = basic_string<Char, M>::len>
+    template<size_t M>
     constexpr bool operator==(basic_string<Char, M> const& rhs) const
     {
-        return detail::strlen(elems, len)!=detail::strlen(rhs, rlen) ?
-            false : operator_equal_impl(rhs, 0, detail::strlen(elems, len<rlen ? len : rlen));
+        return length == rhs.size() && detail::equal(elems.data, rhs.data(), length);
     }
 
     template<size_t M>
     constexpr bool operator==(Char const (&rhs)[M]) const
     {
-        return detail::strlen(elems, len)!=detail::strlen(rhs, M) ?
-            false : operator_equal_impl(rhs, 0, detail::strlen(elems, len<M ? len : M));
+        return length == detail::strlen(rhs, M) && detail::equal<Char>(elems.data, rhs, length);
     }
 
     template<size_t M>
@@ -305,16 +327,16 @@ public:
         return ! operator==(rhs);
     }
 
-    template<size_t M, size_t rlen = basic_string<Char, M>::len>
+    template<size_t M>
     constexpr bool operator<(basic_string<Char, M> const& rhs) const
     {
-        return operator_less_impl(detail::strlen(elems, len), detail::strlen(rhs, rlen))(elems, rhs, 0);
+        return detail::compare(elems.data, length, rhs.data(), rhs.size()) < 0;
     }
 
     template<size_t M>
     constexpr bool operator<(Char const(&rhs)[M]) const
     {
-        return operator_less_impl(detail::strlen(elems, len), detail::strlen(rhs, M))(elems, rhs, 0);
+        return detail::compare<Char>(elems.data, length, rhs, detail::strlen(rhs, M)) < 0;
     }
 
     template<size_t M>
@@ -329,16 +351,16 @@ public:
         return ! operator<(rhs);
     }
 
-    template<size_t M, size_t rlen = basic_string<Char, M>::len>
+    template<size_t M>
     constexpr bool operator>(basic_string<Char, M> const& rhs) const
     {
-        return operator_greater_impl(detail::strlen(elems, len), detail::strlen(rhs, rlen))(elems, rhs, 0);
+        return detail::compare(elems.data, length, rhs.data(), rhs.size()) > 0;
     }
 
     template<size_t M>
     constexpr bool operator>(Char const(&rhs)[M]) const
     {
-        return operator_greater_impl(detail::strlen(elems, len), detail::strlen(rhs, M))(elems, rhs, 0);
+        return detail::compare<Char>(elems.data, length, rhs, detail::strlen(rhs, M)) > 0;
     }
 
     template<size_t M>
@@ -353,95 +375,223 @@ public:
         return ! operator>(rhs);
     }
 
-    template<class C, size_t J>
-    friend inline std::ostream &operator<<(std::ostream &os, basic_string<C, J> const& rhs);
+    // search (the index or npos like std::basic_string)
+    template<size_t M>
+    constexpr size_type find(basic_string<Char, M> const& str, size_type pos = 0) const
+    {
+        return detail::find<Char>(elems.data, length, str.data(), str.size(), pos);
+    }
 
-    // conversions
-    std::basic_string<Char> to_std_string() const
+    template<size_t M>
+    constexpr size_type find(Char const (&str)[M], size_type pos = 0) const
     {
-        return {data()};
+        return detail::find<Char>(elems.data, length, str, detail::strlen(str, M), pos);
     }
 
-private:
-    template<size_t M, size_t... Indices>
-    constexpr basic_string(Char const (&str)[M], detail::indices<Indices...>)
-        : elems({{str[Indices]...}})
-    {}
+    constexpr size_type find(Char c, size_type pos = 0) const
+    {
+        return detail::find<Char>(elems.data, length, &c, 1, pos);
+    }
 
-    template<size_t... Indices>
-    constexpr basic_string(Char const *str, size_t len, detail::indices<Indices...>)
-        : elems({{(Indices < len ? str[Indices] : static_cast<Char>('\0'))...}})
-    {}
+    template<size_t M>
+    constexpr size_type rfind(basic_string<Char, M> const& str, size_type pos = npos) const
+    {
+        return detail::rfind<Char>(elems.data, length, str.data(), str.size(), pos);
+    }
 
-    template<size_t M, size_t... Indices>
-    constexpr basic_string(basic_string<Char, M> const& rhs, detail::indices<Indices...>)
-        : elems({{(Indices < basic_string<Char, M>::len ? rhs[Indices] : static_cast<Char>('\0'))...}})
-    {}
+    template<size_t M>
+    constexpr size_type rfind(Char const (&str)[M], size_type pos = npos) const
+    {
+        return detail::rfind<Char>(elems.data, length, str, detail::strlen(str, M), pos);
+    }
 
-    template<size_t... IndicesL>
-    constexpr basic_string<Char, N+1> operator_plus_char_impl(Char rhs, size_t len_lhs, detail::indices<IndicesL...>) const
+    constexpr size_type rfind(Char c, size_type pos = npos) const
     {
-        // use of explicit ctor for basic_string(Char)
-        return {{{
-                      ( IndicesL < len_lhs ? elems[IndicesL] :
-                        IndicesL == len_lhs ? rhs : static_cast<Char>('\0') )...
-               }}};
+        return detail::rfind<Char>(elems.data, length, &c, 1, pos);
     }
 
-    template<class Array>
-    constexpr bool operator_equal_impl(Array const& rhs, size_t idx, size_t max_size) const
+    template<size_t M>
+    constexpr size_type find_first_of(basic_string<Char, M> const& str, size_type pos = 0) const
     {
-        return idx == max_size ? true : elems[idx] == rhs[idx] && operator_equal_impl(rhs, idx+1, max_size);
+        return detail::find_first_of<Char>(elems.data, length, str.data(), str.size(), pos, true);
     }
 
-    class operator_less_impl{
-        size_t const size_lhs;
-        size_t const size_rhs;
+    template<size_t M>
+    constexpr size_type find_first_of(Char const (&str)[M], size_type pos = 0) const
+    {
+        return detail::find_first_of<Char>(elems.data, length, str, detail::strlen(str, M), pos, true);
+    }
 
-    public:
-        constexpr operator_less_impl(size_t sl, size_t sr)
-            : size_lhs(sl), size_rhs(sr) {}
+    constexpr size_type find_first_of(Char c, size_type pos = 0) const
+    {
+        return detail::find_first_of<Char>(elems.data, length, &c, 1, pos, true);
+    }
 
-        template<class ArrayL, class ArrayR>
-        constexpr bool operator()(ArrayL const& lhs, ArrayR const& rhs, size_t idx) const
-        {
-            return idx == size_rhs ? false :
-                   idx == size_lhs ? true :
-                   lhs[idx] < rhs[idx] ? true :
-                   lhs[idx] > rhs[idx] ? false :
-                                         operator()(lhs, rhs, idx+1);
-        }
-    };
+    template<size_t M>
+    constexpr size_type find_first_not_of(basic_string<Char, M> const& str, size_type pos = 0) const
+    {
+        return detail::find_first_of<Char>(elems.data, length, str.data(), str.size(), pos, false);
+    }
 
-    class operator_greater_impl{
-        size_t const size_lhs;
-        size_t const size_rhs;
+    template<size_t M>
+    constexpr size_type find_first_not_of(Char const (&str)[M], size_type pos = 0) const
+    {
+        return detail::find_first_of<Char>(elems.data, length, str, detail::strlen(str, M), pos, false);
+    }
 
-    public:
-        constexpr operator_greater_impl(size_t sl, size_t sr)
-            : size_lhs(sl), size_rhs(sr) {}
+    constexpr size_type find_first_not_of(Char c, size_type pos = 0) const
+    {
+        return detail::find_first_of<Char>(elems.data, length, &c, 1, pos, false);
+    }
 
-        template<class ArrayL, class ArrayR>
-        constexpr bool operator()(ArrayL const& lhs, ArrayR const& rhs, size_t idx) const
-        {
-            return idx == size_lhs ? false :
-                   idx == size_rhs ? true :
-                   lhs[idx] < rhs[idx] ? false :
-                   lhs[idx] > rhs[idx] ? true :
-                                         operator()(lhs, rhs, idx+1);
-        }
-    };
+    template<size_t M>
+    constexpr size_type find_last_of(basic_string<Char, M> const& str, size_type pos = npos) const
+    {
+        return detail::find_last_of<Char>(elems.data, length, str.data(), str.size(), pos, true);
+    }
+
+    template<size_t M>
+    constexpr size_type find_last_of(Char const (&str)[M], size_type pos = npos) const
+    {
+        return detail::find_last_of<Char>(elems.data, length, str, detail::strlen(str, M), pos, true);
+    }
 
-    constexpr size_type size_impl(size_type idx) const
+    constexpr size_type find_last_of(Char c, size_type pos = npos) const
     {
-        return elems[idx] == '\0' || !(idx < len) ?
-            0 : 1 + size_impl(idx+1);
+        return detail::find_last_of<Char>(elems.data, length, &c, 1, pos, true);
     }
 
+    template<size_t M>
+    constexpr size_type find_last_not_of(basic_string<Char, M> const& str, size_type pos = npos) const
+    {
+        return detail::find_last_of<Char>(elems.data, length, str.data(), str.size(), pos, false);
+    }
+
+    template<size_t M>
+    constexpr size_type find_last_not_of(Char const (&str)[M], size_type pos = npos) const
+    {
+        return detail::find_last_of<Char>(elems.data, length, str, detail::strlen(str, M), pos, false);
+    }
+
+    constexpr size_type find_last_not_of(Char c, size_type pos = npos) const
+    {
+        return detail::find_last_of<Char>(elems.data, length, &c, 1, pos, false);
+    }
+
+    template<size_t M>
+    constexpr bool starts_with(basic_string<Char, M> const& str) const
+    {
+        return str.size() <= length && detail::equal(elems.data, str.data(), str.size());
+    }
+
+    template<size_t M>
+    constexpr bool starts_with(Char const (&str)[M]) const
+    {
+        return detail::strlen(str, M) <= length && detail::equal<Char>(elems.data, str, detail::strlen(str, M));
+    }
+
+    constexpr bool starts_with(Char c) const
+    {
+        return length > 0 && elems.data[0] == c;
+    }
+
+    template<size_t M>
+    constexpr bool ends_with(basic_string<Char, M> const& str) const
+    {
+        return str.size() <= length && detail::equal(elems.data + (length - str.size()), str.data(), str.size());
+    }
+
+    template<size_t M>
+    constexpr bool ends_with(Char const (&str)[M]) const
+    {
+        return detail::strlen(str, M) <= length && detail::equal<Char>(elems.data + (length - detail::strlen(str, M)), str, detail::strlen(str, M));
+    }
+
+    constexpr bool ends_with(Char c) const
+    {
+        return length > 0 && elems.data[length-1] == c;
+    }
+
+    template<size_t M>
+    constexpr bool contains(basic_string<Char, M> const& str) const
+    {
+        return find(str) != npos;
+    }
+
+    template<size_t M>
+    constexpr bool contains(Char const (&str)[M]) const
+    {
+        return find(str) != npos;
+    }
+
+    constexpr bool contains(Char c) const
+    {
+        return find(c) != npos;
+    }
+
+    template<class C, size_t J>
+    friend inline std::ostream &operator<<(std::ostream &os, basic_string<C, J> const& rhs);
+
+    template<class C, size_t L, size_t R>
+    friend class detail::operator_plus_impl;
+
+    // 64bit FNV-1a of the characters in [0, size())
+    constexpr std::uint64_t hash() const
+    {
+        return detail::fnv1a(elems.data, length);
+    }
+
+    // conversions
+    std::basic_string<Char> to_std_string() const
+    {
+        return {data(), length};
+    }
+
+private:
+    // the caller guarantees that n is the index of the first '\0' in aw (or len)
+    constexpr basic_string(detail::array_wrapper<Char, len> aw, size_type n)
+        : elems(aw), length(n)
+    {}
+
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+    template<size_t M>
+    constexpr basic_string(Char const (&str)[M], detail::copy_loop<len>)
+        : elems(detail::make_array_wrapper<Char, len>(str, M)), length(detail::strnlen(str, M))
+    {}
+
+    constexpr basic_string(Char const *str, size_t n, detail::copy_loop<len>)
+        : elems(detail::make_array_wrapper<Char, len>(str, n)), length(n)
+    {}
+
+    template<size_t M>
+    constexpr basic_string(basic_string<Char, M> const& rhs, detail::copy_loop<len>)
+        : elems(detail::make_array_wrapper<Char, len>(rhs.data(), basic_string<Char, M>::len)), length(rhs.size())
+    {}
+#else
+    template<size_t M, size_t... Indices>
+    constexpr basic_string(Char const (&str)[M], detail::indices<Indices...>)
+        : elems({{(Indices < M ? str[Indices] : static_cast<Char>('\0'))...}}), length(detail::strnlen(str, M))
+    {}
+
+    template<size_t... Indices>
+    constexpr basic_string(Char const *str, size_t len, detail::indices<Indices...>)
+        : elems({{(Indices < len ? str[Indices] : static_cast<Char>('\0'))...}}), length(len)
+    {}
+
+    template<size_t M, size_t... Indices>
+    constexpr basic_string(basic_string<Char, M> const& rhs, detail::indices<Indices...>)
+        : elems({{(Indices < basic_string<Char, M>::len ? rhs[Indices] : static_cast<Char>('\0'))...}}), length(rhs.size())
+    {}
+#endif
+
 private:
     detail::array_wrapper<Char, len> const elems;
+    size_type const length;
 }; // class basic_string
 
+template<class Char, size_t N>
+constexpr typename basic_string<Char, N>::size_type basic_string<Char, N>::npos;
+
 } // namespace frozen
 
 
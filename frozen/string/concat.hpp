@@ -0,0 +1,205 @@
+#if !defined FROZEN_STRING_CONCAT_HPP_INCLUDED
+#define      FROZEN_STRING_CONCAT_HPP_INCLUDED
+
+#include <cstddef>
+#include <utility>
+
+#include "../type_traits_aliases.hpp"
+#include "./detail/indices.hpp"
+#include "./detail/array_wrapper.hpp"
+#include "./detail/strlen.hpp"
+#include "./detail/util.hpp"
+#include "./basic_string.hpp"
+#include "./to_string.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+namespace detail {
+
+    // character type of the result: the one of the first string or character
+    template<class... Args>
+    struct concat_char{
+        typedef char type;
+    };
+
+    template<class Char, size_t N, class... Args>
+    struct concat_char<basic_string<Char, N>, Args...>{
+        typedef Char type;
+    };
+
+    template<class Char, size_t M, class... Args>
+    struct concat_char<Char[M], Args...>{
+        typedef Char type;
+    };
+
+    template<class T, class... Args>
+    struct concat_char<T, Args...>
+        : alias::conditional<
+              detail::check_char<T>::value,
+              std::common_type<T>,
+              concat_char<Args...>
+          >
+    {};
+
+    // the maximum number of characters each operand contributes
+    template<class Char, class T, class = void>
+    struct concat_capacity;
+
+    template<class Char, size_t N>
+    struct concat_capacity<Char, basic_string<Char, N>>
+        : std::integral_constant<size_t, basic_string<Char, N>::len>
+    {};
+
+    template<class Char, class C, size_t M>
+    struct concat_capacity<Char, C[M]>
+        : std::integral_constant<size_t, M - 1>
+    {};
+
+    template<class Char, class C>
+    struct concat_capacity<Char, C, alias::enable_if<detail::check_char<C>::value>>
+        : std::integral_constant<size_t, 1>
+    {};
+
+    template<class Char, class Num>
+    struct concat_capacity<Char, Num, alias::enable_if<
+                                          !detail::check_char<Num>::value &&
+                                          ( std::is_integral<Num>::value || std::is_floating_point<Num>::value )
+                                      >>
+        : std::integral_constant<size_t, decltype(to_basic_string<Char>(std::declval<Num>()))::len>
+    {};
+
+    template<class Char, class... Args>
+    struct concat_total;
+
+    template<class Char>
+    struct concat_total<Char> : std::integral_constant<size_t, 0>
+    {};
+
+    template<class Char, class Head, class... Tail>
+    struct concat_total<Char, Head, Tail...>
+        : std::integral_constant<size_t, concat_capacity<Char, Head>::value + concat_total<Char, Tail...>::value>
+    {};
+
+    // numbers are formatted first; every other operand is passed through
+    template<class Char, class T>
+    inline constexpr
+    alias::enable_if<
+        !detail::check_char<T>::value && ( std::is_integral<T>::value || std::is_floating_point<T>::value ),
+        decltype(to_basic_string<Char>(std::declval<T>()))
+    >
+    concat_operand(T const& t)
+    {
+        return to_basic_string<Char>(t);
+    }
+
+    template<class Char, class T>
+    inline constexpr
+    alias::enable_if<
+        detail::check_char<T>::value || !( std::is_integral<T>::value || std::is_floating_point<T>::value ),
+        T const&
+    >
+    concat_operand(T const& t)
+    {
+        return t;
+    }
+
+    // view of one operand; a character is held by value.  data is not
+    // compared with nullptr: GCC does not take the address of a temporary
+    // as constant in a template argument at namespace scope
+    template<class Char>
+    struct concat_piece{
+        Char const* data;
+        size_t size;
+        Char c;
+        bool by_value;
+
+        constexpr Char operator[](size_t idx) const
+        {
+            return by_value ? c : data[idx];
+        }
+    };
+
+    template<class Char, size_t N>
+    inline constexpr concat_piece<Char> as_piece(basic_string<Char, N> const& s)
+    {
+        return {s.data(), s.size(), static_cast<Char>('\0'), false};
+    }
+
+    template<class Char, size_t M>
+    inline constexpr concat_piece<Char> as_piece(Char const (&s)[M])
+    {
+        return {s, detail::strlen(s, M), static_cast<Char>('\0'), false};
+    }
+
+    template<class Char, class C, class = alias::enable_if<detail::check_char<C>::value>>
+    inline constexpr concat_piece<Char> as_piece(C c)
+    {
+        return {nullptr, 1, static_cast<Char>(c), true};
+    }
+
+    template<class Char>
+    inline constexpr Char concat_char_at(size_t)
+    {
+        return static_cast<Char>('\0');
+    }
+
+    template<class Char, class... Pieces>
+    inline constexpr Char concat_char_at(size_t idx, concat_piece<Char> const& head, Pieces const&... tail)
+    {
+        return idx < head.size ? head[idx] : detail::concat_char_at<Char>(idx - head.size, tail...);
+    }
+
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+    template<class Char, size_t N, class... Pieces>
+    inline constexpr
+    basic_string<Char, N> concat_fill(detail::copy_loop<basic_string<Char, N>::len>, Pieces const&... pieces)
+    {
+        concat_piece<Char> const all[] = {pieces..., {nullptr, 0, static_cast<Char>('\0'), true}};
+        detail::array_wrapper<Char, basic_string<Char, N>::len> r{};
+        size_t out = 0;
+        for(size_t p = 0; p < sizeof...(Pieces); ++p){
+            for(size_t i = 0; i < all[p].size; ++i){
+                r.data[out++] = all[p][i];
+            }
+        }
+        return r;
+    }
+#else
+    template<class Char, size_t N, size_t... Indices, class... Pieces>
+    inline constexpr
+    basic_string<Char, N> concat_fill(detail::indices<Indices...>, Pieces const&... pieces)
+    {
+        return detail::array_wrapper<Char, basic_string<Char, N>::len>{{
+                   detail::concat_char_at<Char>(Indices, pieces...)...
+               }};
+    }
+#endif
+
+    template<class Char, size_t N, class... Operands>
+    inline constexpr
+    basic_string<Char, N> concat_impl(Operands const&... operands)
+    {
+        return detail::concat_fill<Char, N>(detail::copy_indices<basic_string<Char, N>::len>(), detail::as_piece<Char>(operands)...);
+    }
+
+} // namespace detail
+
+// @brief: concatenate strings, string literals, characters and numbers in one pass.
+//         The capacity is computed once from all operands, and no intermediate
+//         strings are built.
+//
+//   frozen::concat("Today is ", 8, '/', 5); // "Today is 8/5"
+template<class... Args,
+         class Char = typename detail::concat_char<alias::remove_cv<alias::remove_reference<Args>>...>::type,
+         size_t N = detail::concat_total<Char, alias::remove_cv<alias::remove_reference<Args>>...>::value + 1>
+inline constexpr
+basic_string<Char, N> concat(Args const&... args)
+{
+    return detail::concat_impl<Char, N>(detail::concat_operand<Char>(args)...);
+}
+
+} // namespace frozen
+
+#endif    // FROZEN_STRING_CONCAT_HPP_INCLUDED
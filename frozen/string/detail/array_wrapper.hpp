@@ -3,6 +3,8 @@
 
 #include <cstddef>
 
+#include "./macros.hpp"
+
 namespace frozen {
 namespace detail {
 
@@ -24,6 +26,20 @@ namespace detail {
         }
     };
 
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+    // the first n characters of s followed by '\0's; a loop instead of an
+    // index pack keeps the cost for the compiler linear in N
+    template<class Char, size_t N, class String>
+    inline constexpr array_wrapper<Char, N> make_array_wrapper(String const& s, size_t n)
+    {
+        array_wrapper<Char, N> r{};
+        for(size_t i = 0; i < n && i < N; ++i){
+            r.data[i] = s[i];
+        }
+        return r;
+    }
+#endif
+
 } // namespace detail
 } // namespace frozen
 
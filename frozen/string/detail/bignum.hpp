@@ -0,0 +1,196 @@
+#if !defined FROZEN_STRING_DETAIL_BIGNUM_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_BIGNUM_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+#include "./macros.hpp"
+#include "./carray.hpp"
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    // non-negative integer of at most L 32bit limbs
+    template<size_t L>
+    class bignum{
+    public:
+        constexpr bignum()
+            : limbs{}, size(0)
+        {}
+
+        constexpr explicit bignum(std::uint32_t n)
+            : limbs{}, size(n ? 1 : 0)
+        {
+            limbs[0] = n;
+        }
+
+        static constexpr bignum pow2(size_t exp)
+        {
+            bignum b(1);
+            b.shift_left(exp);
+            return b;
+        }
+
+        constexpr size_t limb_size() const noexcept
+        {
+            return size;
+        }
+
+        constexpr std::uint32_t limb(size_t idx) const noexcept
+        {
+            return limbs[idx];
+        }
+
+        constexpr bool is_zero() const noexcept
+        {
+            return size == 0;
+        }
+
+        constexpr bool is_odd() const noexcept
+        {
+            return size && (limbs[0] & 1);
+        }
+
+        constexpr size_t bit_length() const noexcept
+        {
+            size_t bits = 0;
+            for(std::uint32_t top = size ? limbs[size-1] : 0; top; top >>= 1){
+                ++bits;
+            }
+            return size ? (size-1) * 32 + bits : 0;
+        }
+
+        constexpr void shift_right(size_t bits)
+        {
+            size_t const limb_shift = bits / 32;
+            unsigned const bit_shift = bits % 32;
+            for(size_t i = 0; i < size; ++i){
+                limbs[i] = i + limb_shift < size ? limbs[i + limb_shift] >> bit_shift : 0;
+                if(bit_shift && i + limb_shift + 1 < size){
+                    limbs[i] |= limbs[i + limb_shift + 1] << (32 - bit_shift);
+                }
+            }
+            trim();
+        }
+
+        // @brief: divide by d and return the remainder
+        constexpr std::uint32_t div_small(std::uint32_t d)
+        {
+            std::uint64_t rem = 0;
+            for(size_t i = size; i > 0; --i){
+                std::uint64_t const t = (rem << 32) | limbs[i-1];
+                limbs[i-1] = static_cast<std::uint32_t>(t / d);
+                rem = t % d;
+            }
+            trim();
+            return static_cast<std::uint32_t>(rem);
+        }
+
+        constexpr void mul_small(std::uint32_t m)
+        {
+            std::uint64_t carry = 0;
+            for(size_t i = 0; i < size; ++i){
+                std::uint64_t const t = static_cast<std::uint64_t>(limbs[i]) * m + carry;
+                limbs[i] = static_cast<std::uint32_t>(t);
+                carry = t >> 32;
+            }
+            if(carry){
+                limbs[size++] = static_cast<std::uint32_t>(carry);
+            }
+        }
+
+        constexpr void mul_pow10(size_t exp)
+        {
+            for(; exp >= 9; exp -= 9){
+                mul_small(1000000000u);
+            }
+            std::uint32_t m = 1;
+            for(; exp > 0; --exp){
+                m *= 10;
+            }
+            mul_small(m);
+        }
+
+        constexpr void shift_left(size_t bits)
+        {
+            size_t const limb_shift = bits / 32;
+            unsigned const bit_shift = bits % 32;
+            if(size == 0){
+                return;
+            }
+            limbs[size + limb_shift] = 0;
+            for(size_t i = size; i > 0; --i){
+                limbs[i-1 + limb_shift + 1] |= bit_shift ? limbs[i-1] >> (32 - bit_shift) : 0;
+                limbs[i-1 + limb_shift] = limbs[i-1] << bit_shift;
+            }
+            for(size_t i = 0; i < limb_shift; ++i){
+                limbs[i] = 0;
+            }
+            size += limb_shift + 1;
+            trim();
+        }
+
+        constexpr void add(bignum const& rhs)
+        {
+            std::uint64_t carry = 0;
+            size_t const n = size > rhs.size ? size : rhs.size;
+            for(size_t i = 0; i < n; ++i){
+                std::uint64_t const t = static_cast<std::uint64_t>(i < size ? limbs[i] : 0) + (i < rhs.size ? rhs.limbs[i] : 0) + carry;
+                limbs[i] = static_cast<std::uint32_t>(t);
+                carry = t >> 32;
+            }
+            size = n;
+            if(carry){
+                limbs[size++] = static_cast<std::uint32_t>(carry);
+            }
+        }
+
+        // @brief: *this must not be less than rhs
+        constexpr void sub(bignum const& rhs)
+        {
+            std::uint32_t borrow = 0;
+            for(size_t i = 0; i < size; ++i){
+                std::uint64_t const r = static_cast<std::uint64_t>(i < rhs.size ? rhs.limbs[i] : 0) + borrow;
+                borrow = limbs[i] < r ? 1 : 0;
+                limbs[i] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(limbs[i]) + (borrow ? (std::uint64_t(1) << 32) : 0) - r);
+            }
+            trim();
+        }
+
+        friend constexpr int compare(bignum const& lhs, bignum const& rhs)
+        {
+            if(lhs.size != rhs.size){
+                return lhs.size < rhs.size ? -1 : 1;
+            }
+            for(size_t i = lhs.size; i > 0; --i){
+                if(lhs.limbs[i-1] != rhs.limbs[i-1]){
+                    return lhs.limbs[i-1] < rhs.limbs[i-1] ? -1 : 1;
+                }
+            }
+            return 0;
+        }
+
+        friend constexpr bignum operator+(bignum lhs, bignum const& rhs)
+        {
+            lhs.add(rhs);
+            return lhs;
+        }
+
+    private:
+        constexpr void trim()
+        {
+            while(size > 0 && limbs[size-1] == 0){
+                --size;
+            }
+        }
+
+        carray<std::uint32_t, L + 1> limbs;
+        size_t size;
+    };
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_BIGNUM_HPP_INCLUDED
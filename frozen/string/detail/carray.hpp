@@ -0,0 +1,41 @@
+#if !defined FROZEN_STRING_DETAIL_CARRAY_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_CARRAY_HPP_INCLUDED
+
+#include <cstddef>
+
+#include "./macros.hpp"
+
+#if !defined FROZEN_HAS_RELAXED_CONSTEXPR
+#    error "this header requires relaxed constexpr (C++14)"
+#endif
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    // array which is modifiable in relaxed constexpr
+    template<class T, size_t N>
+    struct carray{
+        T data[N==0 ? 1 : N];
+
+        constexpr T& operator[](size_t idx)
+        {
+            return data[idx];
+        }
+
+        constexpr T const& operator[](size_t idx) const
+        {
+            return data[idx];
+        }
+
+        constexpr size_t size() const noexcept
+        {
+            return N;
+        }
+    };
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_CARRAY_HPP_INCLUDED
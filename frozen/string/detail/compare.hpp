@@ -0,0 +1,130 @@
+#if !defined FROZEN_STRING_DETAIL_COMPARE_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_COMPARE_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "./macros.hpp"
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    namespace impl {
+
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+        template<class Char>
+        inline constexpr
+        size_t mismatch_impl(Char const* lhs, Char const* rhs, size_t first, size_t last)
+        {
+            for(; first < last; ++first){
+                if(lhs[first] != rhs[first]){
+                    break;
+                }
+            }
+            return first;
+        }
+#else
+        template<class Char>
+        inline constexpr
+        size_t mismatch_impl(Char const* lhs, Char const* rhs, size_t first, size_t last);
+
+        template<class Char>
+        inline constexpr
+        size_t mismatch_right(Char const* lhs, Char const* rhs, size_t found, size_t mid, size_t last)
+        {
+            return found != mid ? found : mismatch_impl(lhs, rhs, mid, last);
+        }
+
+        // bisect [first, last) so that the recursion depth is O(log N)
+        template<class Char>
+        inline constexpr
+        size_t mismatch_impl(Char const* lhs, Char const* rhs, size_t first, size_t last)
+        {
+            return last - first == 0 ? first :
+                   last - first == 1 ? (lhs[first] == rhs[first] ? last : first) :
+                   mismatch_right(lhs, rhs, mismatch_impl(lhs, rhs, first, first + (last-first)/2), first + (last-first)/2, last);
+        }
+#endif
+
+        // memcmp() is vectorized by the C library, so equality only needs it
+        template<class Char>
+        inline
+        bool equal_runtime(Char const* lhs, Char const* rhs, size_t n) noexcept
+        {
+            return std::memcmp(lhs, rhs, n * sizeof(Char)) == 0;
+        }
+
+        // skip the common prefix one machine word at a time, then find the
+        // exact position character by character
+        template<class Char>
+        inline
+        size_t mismatch_runtime(Char const* lhs, Char const* rhs, size_t n) noexcept
+        {
+            typedef std::uintptr_t word_type;
+            static constexpr size_t chars_per_word = sizeof(word_type) / sizeof(Char) ? sizeof(word_type) / sizeof(Char) : 1;
+
+            size_t idx = 0;
+            for(; idx + chars_per_word <= n; idx += chars_per_word){
+                word_type l, r;
+                std::memcpy(&l, lhs + idx, sizeof(l));
+                std::memcpy(&r, rhs + idx, sizeof(r));
+                if(l != r){
+                    break;
+                }
+            }
+            for(; idx < n; ++idx){
+                if(lhs[idx] != rhs[idx]){
+                    break;
+                }
+            }
+            return idx;
+        }
+
+    } // namespace impl
+
+    // @brief: the first index in [0, n) where lhs and rhs differ, or n.
+    template<class Char>
+    inline constexpr
+    size_t mismatch(Char const* lhs, Char const* rhs, size_t n)
+    {
+        return FROZEN_IS_CONSTANT_EVALUATED() ?
+                   impl::mismatch_impl(lhs, rhs, 0, n) :
+                   impl::mismatch_runtime(lhs, rhs, n);
+    }
+
+    template<class Char>
+    inline constexpr
+    bool equal(Char const* lhs, Char const* rhs, size_t n)
+    {
+        return FROZEN_IS_CONSTANT_EVALUATED() ?
+                   impl::mismatch_impl(lhs, rhs, 0, n) == n :
+                   impl::equal_runtime(lhs, rhs, n);
+    }
+
+    template<class Char>
+    inline constexpr
+    int compare_at(Char const* lhs, size_t size_lhs, Char const* rhs, size_t size_rhs, size_t idx)
+    {
+        return idx == size_lhs && idx == size_rhs ? 0 :
+               idx == size_lhs ? -1 :
+               idx == size_rhs ? 1 :
+               lhs[idx] < rhs[idx] ? -1 : 1;
+    }
+
+    // @brief: lexicographical comparison of [lhs, lhs+size_lhs) and [rhs, rhs+size_rhs).
+    //         returns negative, 0 or positive like std::char_traits<>::compare().
+    template<class Char>
+    inline constexpr
+    int compare(Char const* lhs, size_t size_lhs, Char const* rhs, size_t size_rhs)
+    {
+        return compare_at(lhs, size_lhs, rhs, size_rhs,
+                          detail::mismatch(lhs, rhs, size_lhs < size_rhs ? size_lhs : size_rhs));
+    }
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_COMPARE_HPP_INCLUDED
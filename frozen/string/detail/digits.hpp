@@ -25,7 +25,67 @@ namespace detail {
     inline constexpr
     size_t int_max_digits10() noexcept
     {
-        return std::numeric_limits<Int>::digits10 + 1;
+        // one more slot for '-', as in "-2147483648"
+        return std::numeric_limits<Int>::digits10 + 1 + std::is_signed<Int>::value;
+    }
+
+    // lookup tables for integer formatting
+    template<class T = void>
+    struct digits_tables{
+        static constexpr unsigned long long pow10[20] = {
+            1ull, 10ull, 100ull, 1000ull,
+            10000ull, 100000ull, 1000000ull, 10000000ull,
+            100000000ull, 1000000000ull, 10000000000ull, 100000000000ull,
+            1000000000000ull, 10000000000000ull, 100000000000000ull, 1000000000000000ull,
+            10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+        };
+
+        // "00", "01", ..., "99"
+        static constexpr char pairs[201] =
+            "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+            "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+    };
+
+    template<class T>
+    constexpr unsigned long long digits_tables<T>::pow10[20];
+
+    template<class T>
+    constexpr char digits_tables<T>::pairs[201];
+
+    // |i| without overflow on the minimum value
+    template< class Int,
+              alias::enable_if<
+                  std::is_signed<
+                      alias::decay<Int>
+                  >::value
+              >*& = detail::enabler
+            >
+    inline constexpr
+    unsigned long long magnitude_of(Int i) noexcept
+    {
+        return i < 0 ? 0ull - static_cast<unsigned long long>(i) : static_cast<unsigned long long>(i);
+    }
+
+    template< class Int,
+              alias::enable_if<
+                  !std::is_signed<
+                      alias::decay<Int>
+                  >::value
+              >*& = detail::enabler
+            >
+    inline constexpr
+    unsigned long long magnitude_of(Int i) noexcept
+    {
+        return static_cast<unsigned long long>(i);
+    }
+
+    inline constexpr
+    size_t uint_digits10(unsigned long long u) noexcept
+    {
+        return u < 10ull ? 1 :
+               u < 100ull ? 2 :
+               u < 1000ull ? 3 :
+               u < 10000ull ? 4 : 4 + detail::uint_digits10(u / 10000ull);
     }
 
     template< class Int,
@@ -38,7 +98,7 @@ namespace detail {
     inline constexpr
     size_t digits10_of(Int i)
     {
-        return detail::abs(i)<1 ? 1 : detail::log10(detail::abs(i))+1;
+        return detail::uint_digits10(detail::magnitude_of(i));
     }
 
     static constexpr size_t float_digits10_of_fractional_part = 6;
@@ -74,7 +134,14 @@ namespace detail {
     inline constexpr
     size_t digits10_at(Int i, size_t idx) noexcept
     {
-        return static_cast<Int>(detail::abs(i)) / static_cast<size_t>(detail::pow(10, idx)) % 10;
+        return detail::magnitude_of(i) / digits_tables<>::pow10[idx] % 10;
+    }
+
+    // the character of the idx-th digit from the right, read two digits at a time
+    inline constexpr
+    char digits10_char_at(unsigned long long u, size_t idx) noexcept
+    {
+        return digits_tables<>::pairs[2 * (u / digits_tables<>::pow10[idx & ~size_t(1)] % 100) + 1 - (idx & 1)];
     }
 
     template< class Float,
@@ -89,6 +156,24 @@ namespace detail {
             std::numeric_limits<Float>::max_exponent10 + float_digits10_of_fractional_part + 2;
     };
 
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+    template< class Float >
+    inline constexpr
+    size_t fmod10(Float f)
+    {
+        for(size_t base = std::numeric_limits<Float>::max_exponent10 - 2; base >= 2; ){
+            if(f - detail::pow(10.0, base) < 0){
+                base -= 2;
+            }else{
+                f -= detail::pow(10.0, base);
+            }
+        }
+        while(f >= 10.0){
+            f -= 10;
+        }
+        return static_cast<size_t>(f);
+    }
+#else
     template< class Float >
     inline constexpr
     size_t fmod10_base(Float f)
@@ -112,6 +197,7 @@ namespace detail {
     {
         return fmod10_impl(f, std::numeric_limits<Float>::max_exponent10 - 2);
     }
+#endif
 
     template< class Float,
               alias::enable_if<
@@ -0,0 +1,159 @@
+#if !defined FROZEN_STRING_DETAIL_EYTZINGER_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_EYTZINGER_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../../type_traits_aliases.hpp"
+#include "./macros.hpp"
+#include "./carray.hpp"
+#include "./compare.hpp"
+#include "./pmh.hpp"
+#include "./util.hpp"
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    // the first characters of a string packed into 64 bits so that comparing
+    // two prefixes as integers orders them like detail::compare() orders the
+    // strings, whenever the prefixes differ
+    template<class Char>
+    struct eytzinger_prefix{
+        typedef alias::conditional<std::is_signed<Char>::value, typename std::make_unsigned<Char>::type, Char> unsigned_type;
+        static constexpr size_t bits = sizeof(Char) * 8;
+        static constexpr size_t chars = 64 / bits;
+
+        // signed characters are biased so that they compare as unsigned ones
+        static constexpr std::uint64_t code(Char c) noexcept
+        {
+            return static_cast<std::uint64_t>(static_cast<unsigned_type>(c)) ^
+                   (std::is_signed<Char>::value ? static_cast<std::uint64_t>(1) << (bits - 1) : 0);
+        }
+
+        static constexpr std::uint64_t of(Char const* s, size_t n) noexcept
+        {
+            std::uint64_t r = 0;
+            for(size_t i = 0; i < chars; ++i){
+                r = (r << bits) | (i < n ? code(s[i]) : 0);
+            }
+            return r;
+        }
+    };
+
+    // stable bottom-up merge sort of the indices of [keys, keys+N)
+    template<size_t N, class Key>
+    inline constexpr carray<size_t, N> eytzinger_sort(Key const* keys)
+    {
+        carray<size_t, N> order{}, buffer{};
+        for(size_t i = 0; i < N; ++i){
+            order[i] = i;
+        }
+        for(size_t width = 1; width < N; width *= 2){
+            for(size_t first = 0; first < N; first += 2 * width){
+                size_t const mid = first + width < N ? first + width : N;
+                size_t const last = first + 2 * width < N ? first + 2 * width : N;
+                size_t l = first, r = mid, out = first;
+                while(l < mid && r < last){
+                    buffer[out++] = keys[order[r]] < keys[order[l]] ? order[r++] : order[l++];
+                }
+                while(l < mid){
+                    buffer[out++] = order[l++];
+                }
+                while(r < last){
+                    buffer[out++] = order[r++];
+                }
+            }
+            for(size_t i = 0; i < N; ++i){
+                order[i] = buffer[i];
+            }
+        }
+        return order;
+    }
+
+    // the sorted order of the keys; duplicates are rejected
+    template<size_t N, class Key>
+    inline constexpr carray<size_t, N> eytzinger_order(Key const* keys)
+    {
+        carray<size_t, N> const order = detail::eytzinger_sort<N>(keys);
+        for(size_t i = 1; i < N; ++i){
+            if(!(keys[order[i - 1]] < keys[order[i]])){
+                throw std::invalid_argument("frozen::sorted_set: duplicate keys");
+            }
+        }
+        return order;
+    }
+
+    // a node of the implicit search tree: the prefix of its key and the
+    // rank of the key in sorted order
+    template<size_t N>
+    struct eytzinger_node{
+        std::uint64_t prefix;
+        uint_least_for<N> rank;
+    };
+
+    // the sorted keys laid out in breadth first order of a complete binary
+    // search tree: the children of the node k are 2k and 2k+1, the root is 1
+    template<class Char, size_t N>
+    class eytzinger_tree{
+    public:
+        typedef eytzinger_node<N> node_type;
+
+        template<class Key>
+        constexpr explicit eytzinger_tree(Key const* sorted)
+            : nodes_{}
+        {
+            fill(sorted, 0, 1);
+        }
+
+        // @brief: the rank of the first key for which before(node) is false,
+        //         or N.  The descent takes no branch which depends on the keys.
+        template<class Before>
+        constexpr size_t partition_point(Before const& before) const
+        {
+            size_t k = 1;
+            while(k <= N){
+                k = 2 * k + static_cast<size_t>(before(nodes_[k]));
+            }
+            // the answer is where the descent last went left
+            k >>= trailing_ones(k) + 1;
+            return k == 0 ? N : nodes_[k].rank;
+        }
+
+    private:
+        // an in-order walk of the tree visits the keys in sorted order
+        template<class Key>
+        constexpr size_t fill(Key const* sorted, size_t rank, size_t k)
+        {
+            if(k <= N){
+                rank = fill(sorted, rank, 2 * k);
+                nodes_[k].prefix = eytzinger_prefix<Char>::of(sorted[rank].data(), sorted[rank].size());
+                nodes_[k].rank = static_cast<uint_least_for<N>>(rank);
+                rank = fill(sorted, rank + 1, 2 * k + 1);
+            }
+            return rank;
+        }
+
+        static constexpr size_t trailing_ones(size_t k) noexcept
+        {
+#if defined __GNUC__
+            return static_cast<size_t>(__builtin_ctzll(~static_cast<unsigned long long>(k)));
+#else
+            size_t r = 0;
+            for(; k & 1; k >>= 1){
+                ++r;
+            }
+            return r;
+#endif
+        }
+
+        carray<node_type, N + 1> nodes_;
+    };
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_EYTZINGER_HPP_INCLUDED
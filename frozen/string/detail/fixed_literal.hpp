@@ -0,0 +1,48 @@
+#if !defined FROZEN_STRING_DETAIL_FIXED_LITERAL_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_FIXED_LITERAL_HPP_INCLUDED
+
+#include <cstddef>
+
+#include "./macros.hpp"
+#include "./indices.hpp"
+
+#if defined FROZEN_HAS_CLASS_TYPE_NTTP
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    // structural wrapper of a string literal which can be passed as
+    // a template argument:  template<detail::fixed_literal Lit>
+    template<class Char, size_t N>
+    struct fixed_literal{
+        typedef Char char_type;
+        static constexpr size_t size = N;
+
+        Char data[N];
+
+        constexpr fixed_literal(Char const (&str)[N])
+            : fixed_literal(str, detail::make_indices<0, N>())
+        {}
+
+        template<size_t... Indices>
+        constexpr fixed_literal(Char const (&str)[N], detail::indices<Indices...>)
+            : data{str[Indices]...}
+        {}
+
+        constexpr Char operator[](size_t idx) const
+        {
+            return data[idx];
+        }
+    };
+
+    template<class Char, size_t N>
+    fixed_literal(Char const (&)[N]) -> fixed_literal<Char, N>;
+
+} // namespace detail
+} // namespace frozen
+
+#endif
+
+#endif    // FROZEN_STRING_DETAIL_FIXED_LITERAL_HPP_INCLUDED
@@ -0,0 +1,82 @@
+#if !defined FROZEN_STRING_DETAIL_HASH_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_HASH_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+#include "./macros.hpp"
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    namespace constants {
+        static constexpr std::uint64_t fnv1a_offset_basis = 14695981039346656037ull;
+        static constexpr std::uint64_t fnv1a_prime = 1099511628211ull;
+    } // namespace constants
+
+    namespace impl {
+
+        // each code unit is fed byte by byte from the least significant one,
+        // so the result does not depend on the endianness of the target
+        template<class Char>
+        inline constexpr
+        std::uint64_t fnv1a_char(std::uint64_t h, Char c, size_t byte)
+        {
+            return byte == sizeof(Char) ? h :
+                   fnv1a_char((h ^ ((static_cast<std::uint64_t>(c) >> (byte * 8)) & 0xff)) * constants::fnv1a_prime, c, byte+1);
+        }
+
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+        template<class Char>
+        inline constexpr
+        std::uint64_t fnv1a_impl(std::uint64_t h, Char const* s, size_t first, size_t last)
+        {
+            for(; first < last; ++first){
+                h = fnv1a_char(h, s[first], 0);
+            }
+            return h;
+        }
+#else
+        // FNV-1a is a left fold, so [first, last) can be bisected to keep
+        // the recursion depth O(log N)
+        template<class Char>
+        inline constexpr
+        std::uint64_t fnv1a_impl(std::uint64_t h, Char const* s, size_t first, size_t last)
+        {
+            return last - first == 0 ? h :
+                   last - first == 1 ? fnv1a_char(h, s[first], 0) :
+                   fnv1a_impl(fnv1a_impl(h, s, first, first + (last-first)/2), s, first + (last-first)/2, last);
+        }
+#endif
+
+        template<class Char>
+        inline
+        std::uint64_t fnv1a_runtime(Char const* s, size_t n) noexcept
+        {
+            std::uint64_t h = constants::fnv1a_offset_basis;
+            for(size_t i = 0; i < n; ++i){
+                for(size_t byte = 0; byte < sizeof(Char); ++byte){
+                    h = (h ^ ((static_cast<std::uint64_t>(s[i]) >> (byte * 8)) & 0xff)) * constants::fnv1a_prime;
+                }
+            }
+            return h;
+        }
+
+    } // namespace impl
+
+    // @brief: 64bit FNV-1a of [s, s+n).  Gives the same value at compile-time and at runtime.
+    template<class Char>
+    inline constexpr
+    std::uint64_t fnv1a(Char const* s, size_t n)
+    {
+        return FROZEN_IS_CONSTANT_EVALUATED() ?
+                   impl::fnv1a_impl(constants::fnv1a_offset_basis, s, 0, n) :
+                   impl::fnv1a_runtime(s, n);
+    }
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_HASH_HPP_INCLUDED
@@ -62,7 +62,7 @@ namespace detail {
     >
         : detail::make_indices_next<
             typename detail::make_indices_impl<First, Step, N / 2>::type,
-            First + N / 2 * Step
+            N / 2 * Step
         >
     {};
 
@@ -75,7 +75,7 @@ namespace detail {
     >
         : detail::make_indices_next2<
             typename detail::make_indices_impl<First, Step, N / 2>::type,
-            First + N / 2 * Step,
+            N / 2 * Step,
             First + (N - 1) * Step
         >
     {};
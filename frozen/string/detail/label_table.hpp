@@ -0,0 +1,182 @@
+#if !defined FROZEN_STRING_DETAIL_LABEL_TABLE_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_LABEL_TABLE_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "./macros.hpp"
+#include "./carray.hpp"
+#include "./compare.hpp"
+#include "./hash.hpp"
+#include "./pmh.hpp"
+#include "./string_constant.hpp"
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    // the labels one after the other
+    template<class Char, size_t N, size_t Total>
+    struct label_list{
+        carray<Char, Total> chars;
+        carray<size_t, N + 1> offsets;
+        size_t count;
+
+        template<size_t M>
+        constexpr int append(carray<Char, M> const& s, size_t n)
+        {
+            for(size_t i = 0; i < n; ++i){
+                chars[offsets[count] + i] = s[i];
+            }
+            offsets[count + 1] = offsets[count] + n;
+            ++count;
+            return 0;
+        }
+
+        constexpr Char const* data(size_t idx) const
+        {
+            return chars.data + offsets[idx];
+        }
+
+        constexpr size_t size(size_t idx) const
+        {
+            return offsets[idx + 1] - offsets[idx];
+        }
+    };
+
+    template<class... Labels>
+    struct label_total;
+
+    template<>
+    struct label_total<> : std::integral_constant<size_t, 0>
+    {};
+
+    template<class Head, class... Tail>
+    struct label_total<Head, Tail...>
+        : std::integral_constant<size_t, string_constant<Head>::size + label_total<Tail...>::value>
+    {};
+
+    template<class Char, class... Labels>
+    inline constexpr label_list<Char, sizeof...(Labels), label_total<Labels...>::value>
+    make_label_list()
+    {
+        label_list<Char, sizeof...(Labels), label_total<Labels...>::value> r{};
+        int const appended[] = { 0, r.append(string_constant<Labels>::chars(), string_constant<Labels>::size)... };
+        static_cast<void>(appended);
+        return r;
+    }
+
+    // how the labels are told apart before the final comparison: by their
+    // length, by their length and the character at a position, or by a hash
+    // of all the characters
+    enum class label_strategy{ length, position, hash };
+
+    struct label_key{
+        label_strategy strategy;
+        size_t position;
+
+        template<class Char>
+        constexpr std::uint64_t operator()(Char const* s, size_t n) const
+        {
+            return strategy == label_strategy::length ? n :
+                   strategy == label_strategy::position ?
+                       (static_cast<std::uint64_t>(n) << 32) | (position < n ? static_cast<typename std::make_unsigned<Char>::type>(s[position]) : 0u) :
+                   detail::fnv1a(s, n);
+        }
+    };
+
+    template<class Labels>
+    inline constexpr bool label_keys_distinct(Labels const& labels, label_key key)
+    {
+        for(size_t i = 0; i < labels.count; ++i){
+            for(size_t j = 0; j < i; ++j){
+                if(key(labels.data(i), labels.size(i)) == key(labels.data(j), labels.size(j))){
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template<class Labels>
+    inline constexpr bool label_duplicates(Labels const& labels)
+    {
+        for(size_t i = 0; i < labels.count; ++i){
+            for(size_t j = 0; j < i; ++j){
+                if(labels.size(i) == labels.size(j) && detail::equal(labels.data(i), labels.data(j), labels.size(i))){
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // the cheapest key which is different for every label
+    template<class Labels>
+    inline constexpr label_key label_key_of(Labels const& labels)
+    {
+        if(label_keys_distinct(labels, label_key{label_strategy::length, 0})){
+            return {label_strategy::length, 0};
+        }
+        size_t longest = 0;
+        for(size_t i = 0; i < labels.count; ++i){
+            longest = labels.size(i) > longest ? labels.size(i) : longest;
+        }
+        for(size_t p = 0; p < longest; ++p){
+            if(label_keys_distinct(labels, label_key{label_strategy::position, p})){
+                return {label_strategy::position, p};
+            }
+        }
+        return {label_strategy::hash, 0};
+    }
+
+    template<size_t N, class Labels>
+    inline constexpr carray<std::uint64_t, N> label_keys(Labels const& labels, label_key key)
+    {
+        carray<std::uint64_t, N> r{};
+        for(size_t i = 0; i < N; ++i){
+            r[i] = key(labels.data(i), labels.size(i));
+        }
+        return r;
+    }
+
+    // perfect hash of string constants: find() is one table lookup and one
+    // comparison
+    template<class Char, class... Labels>
+    struct label_table{
+        static constexpr size_t size = sizeof...(Labels);
+
+        typedef decltype(make_label_list<Char, Labels...>()) labels_type;
+        static constexpr labels_type labels = make_label_list<Char, Labels...>();
+        static_assert(!label_duplicates(labels), "frozen: the labels must be distinct");
+
+        static constexpr label_key key = label_key_of(labels);
+        typedef pmh_table<size> table_type;
+        static constexpr table_type table = table_type(label_keys<size>(labels, key));
+
+        // @brief: the index of the label equal to [s, s+n), or size
+        static constexpr size_t find(Char const* s, size_t n)
+        {
+            return find_at(table.lookup(key(s, n)), s, n);
+        }
+
+    private:
+        static constexpr size_t find_at(size_t idx, Char const* s, size_t n)
+        {
+            return idx != size && labels.size(idx) == n && detail::equal(labels.data(idx), s, n) ? idx : size;
+        }
+    };
+
+    template<class Char, class... Labels>
+    constexpr typename label_table<Char, Labels...>::labels_type label_table<Char, Labels...>::labels;
+    template<class Char, class... Labels>
+    constexpr label_key label_table<Char, Labels...>::key;
+    template<class Char, class... Labels>
+    constexpr typename label_table<Char, Labels...>::table_type label_table<Char, Labels...>::table;
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_LABEL_TABLE_HPP_INCLUDED
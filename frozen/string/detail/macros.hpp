@@ -1,6 +1,8 @@
 #if !defined FROZEN_STRING_DETAIL_MACROS_HPP_INCLUDED
 #define      FROZEN_STRING_DETAIL_MACROS_HPP_INCLUDED
 
+#include <type_traits>
+
 #if !defined FROZEN_STRING_LITERALS_MAX_LENGTH
 #    define FROZEN_STRING_LITERALS_MAX_LENGTH 256
 #endif
@@ -9,6 +11,50 @@
 #    define FROZEN_CONSTEXPR_MATH_FUNCTIONS_ARE_AVAILABLE
 #endif
 
+// FROZEN_IS_CONSTANT_EVALUATED() is true while a constexpr function is evaluated
+// at compile-time.  When the compiler cannot tell, it is always true and the
+// constexpr implementations are used at runtime as well.
+#if defined __cpp_lib_is_constant_evaluated
+#    define FROZEN_HAS_IS_CONSTANT_EVALUATED
+#    define FROZEN_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined __has_builtin
+#    if __has_builtin(__builtin_is_constant_evaluated)
+#        define FROZEN_HAS_IS_CONSTANT_EVALUATED
+#        define FROZEN_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#    endif
+#endif
+#if !defined FROZEN_HAS_IS_CONSTANT_EVALUATED
+#    define FROZEN_IS_CONSTANT_EVALUATED() true
+#endif
+
+// __builtin_signbit() tells -0.0 from 0.0 in a constant expression
+#if defined __has_builtin
+#    if __has_builtin(__builtin_signbit)
+#        define FROZEN_HAS_BUILTIN_SIGNBIT
+#    endif
+#endif
+
+#if defined __cpp_constexpr && __cpp_constexpr >= 201304L
+#    define FROZEN_HAS_RELAXED_CONSTEXPR
+#endif
+
+#if __cplusplus >= 201703L
+#    define FROZEN_HAS_STRING_VIEW
+#endif
+
+#if defined __cpp_nontype_template_parameter_auto && __cpp_nontype_template_parameter_auto >= 201606L
+#    define FROZEN_HAS_AUTO_NTTP
+#endif
+
+// string literals can be template arguments: either as a class type
+// non-type template parameter (C++20) or through the GNU string literal
+// operator template extension
+#if defined __cpp_nontype_template_args && __cpp_nontype_template_args >= 201911L
+#    define FROZEN_HAS_CLASS_TYPE_NTTP
+#elif defined __GNUC__ && __cplusplus >= 201402L
+#    define FROZEN_HAS_GNU_STRING_LITERAL_OPERATOR_TEMPLATE
+#endif
+
 #define FROZEN_ADD_PAREN(...) ((__VA_ARGS__))
 
 #define FROZEN_NOEXCEPT_DEPENDS_ON_IMPL(expr) noexcept(noexcept(expr))
@@ -0,0 +1,215 @@
+#if !defined FROZEN_STRING_DETAIL_PARSE_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_PARSE_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+
+#include "../../type_traits_aliases.hpp"
+#include "./macros.hpp"
+#include "./digits.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+// @brief: the result of to_integer() and to_floating(), like std::from_chars_result.
+//         pos is the index of the first character which is not part of the number.
+//         On error, value is T() (or +-infinity/0 on floating point overflow/underflow)
+//         and ec is std::errc::invalid_argument or std::errc::result_out_of_range.
+template<class T>
+struct parse_result{
+    T value;
+    size_t pos;
+    std::errc ec;
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return ec == std::errc();
+    }
+};
+
+namespace detail {
+
+    // the value of c as a digit of base 36, or 36
+    template<class Char>
+    inline constexpr
+    unsigned digit36_of(Char c) noexcept
+    {
+        return c >= '0' && c <= '9' ? static_cast<unsigned>(c - '0') :
+               c >= 'a' && c <= 'z' ? static_cast<unsigned>(c - 'a' + 10) :
+               c >= 'A' && c <= 'Z' ? static_cast<unsigned>(c - 'A' + 10) : 36;
+    }
+
+    template<class Char>
+    inline constexpr
+    size_t span_digits(Char const* s, size_t first, size_t last, unsigned base);
+
+    template<class Char>
+    inline constexpr
+    size_t span_digits_right(Char const* s, size_t found, size_t mid, size_t last, unsigned base)
+    {
+        return found != mid ? found : detail::span_digits(s, mid, last, base);
+    }
+
+    // @brief: the first index in [first, last) which is not a digit of base, or last.
+    //         Only '0' is a digit of base 1, which skips leading zeros.
+    template<class Char>
+    inline constexpr
+    size_t span_digits(Char const* s, size_t first, size_t last, unsigned base)
+    {
+        return last - first == 0 ? first :
+               last - first == 1 ? (detail::digit36_of(s[first]) < base ? last : first) :
+               detail::span_digits_right(s, detail::span_digits(s, first, first + (last-first)/2, base), first + (last-first)/2, last, base);
+    }
+
+    inline constexpr
+    size_t uint_digits_in_base(unsigned long long u, unsigned base) noexcept
+    {
+        return u < base ? 1 : 1 + detail::uint_digits_in_base(u / base, base);
+    }
+
+    struct parse_uint{
+        unsigned long long value;
+        bool overflow;
+    };
+
+    inline constexpr
+    parse_uint accumulate_digit(unsigned long long acc, unsigned digit, unsigned base, unsigned long long limit) noexcept
+    {
+        return acc > (limit - digit) / base ? parse_uint{limit, true} : parse_uint{acc * base + digit, false};
+    }
+
+    // the caller guarantees that [idx, last) has no more digits than limit,
+    // so that the recursion is at most 64 deep
+    template<class Char>
+    inline constexpr
+    parse_uint accumulate_digits(Char const* s, size_t idx, size_t last, unsigned base, unsigned long long limit, parse_uint acc) noexcept
+    {
+        return idx == last || acc.overflow ? acc :
+               detail::accumulate_digits(s, idx + 1, last, base, limit,
+                                         detail::accumulate_digit(acc.value, detail::digit36_of(s[idx]), base, limit));
+    }
+
+    template<class T>
+    inline constexpr
+    T negate_magnitude(unsigned long long u) noexcept
+    {
+        // -(u-1)-1 does not overflow on the minimum value
+        return u == 0 ? T() : static_cast<T>(-static_cast<T>(u - 1) - 1);
+    }
+
+    template<class T>
+    inline constexpr
+    parse_result<T> integer_result(parse_uint u, bool negative, size_t last) noexcept
+    {
+        return u.overflow ? parse_result<T>{T(), last, std::errc::result_out_of_range} :
+               parse_result<T>{negative ? detail::negate_magnitude<T>(u.value) : static_cast<T>(u.value), last, std::errc()};
+    }
+
+    template<class T>
+    inline constexpr
+    unsigned long long integer_limit(bool negative) noexcept
+    {
+        return negative ? detail::magnitude_of(std::numeric_limits<T>::min()) : static_cast<unsigned long long>(std::numeric_limits<T>::max());
+    }
+
+    // [first, last) are the digits, [significant, last) without leading zeros
+    template<class T, class Char>
+    inline constexpr
+    parse_result<T> to_integer_digits(Char const* s, size_t significant, size_t last, unsigned base, bool negative) noexcept
+    {
+        return last - significant > detail::uint_digits_in_base(detail::integer_limit<T>(negative), base) ?
+                   parse_result<T>{T(), last, std::errc::result_out_of_range} :
+                   detail::integer_result<T>(
+                       detail::accumulate_digits(s, significant, last, base, detail::integer_limit<T>(negative), parse_uint{0, false}),
+                       negative, last);
+    }
+
+    template<class T, class Char>
+    inline constexpr
+    parse_result<T> to_integer_span(Char const* s, size_t first, size_t last, unsigned base, bool negative) noexcept
+    {
+        return first == last ? parse_result<T>{T(), 0, std::errc::invalid_argument} :
+               detail::to_integer_digits<T>(s, detail::span_digits(s, first, last, 1), last, base, negative);
+    }
+
+    template<class T, class Char>
+    inline constexpr
+    parse_result<T> to_integer_constexpr(Char const* s, size_t n, unsigned base, bool negative) noexcept
+    {
+        return detail::to_integer_span<T>(s, negative, detail::span_digits(s, negative, n, base), base, negative);
+    }
+
+    // eight ASCII digits at once (little endian), see "Faster integer parsing" by Lemire
+    inline
+    bool is_eight_digits(std::uint64_t v) noexcept
+    {
+        return (((v & 0xf0f0f0f0f0f0f0f0ull) | (((v + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4)) == 0x3333333333333333ull);
+    }
+
+    inline
+    std::uint32_t eight_digits_value(std::uint64_t v) noexcept
+    {
+        v -= 0x3030303030303030ull;
+        v = (v * 10) + (v >> 8);
+        return static_cast<std::uint32_t>(
+            ((v & 0x000000ff000000ffull) * (100 + (1000000ull << 32)) +
+             ((v >> 16) & 0x000000ff000000ffull) * (1 + (10000ull << 32))) >> 32);
+    }
+
+    // base 10 char strings are scanned and converted eight digits at a time;
+    // everything else takes the constexpr path
+    template<class T, class Char>
+    inline
+    parse_result<T> to_integer_runtime(Char const* s, size_t n, unsigned base, bool negative) noexcept
+    {
+#if defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        if(sizeof(Char) == 1 && base == 10){
+            size_t last = negative;
+            for(std::uint64_t v; last + 8 <= n; last += 8){
+                std::memcpy(&v, s + last, 8);
+                if(!is_eight_digits(v)){
+                    break;
+                }
+            }
+            for(; last < n && s[last] >= '0' && s[last] <= '9'; ++last){}
+
+            size_t significant = negative;
+            for(; significant < last && s[significant] == '0'; ++significant){}
+
+            // 19 digits always fit in unsigned long long
+            if(last != static_cast<size_t>(negative) && last - significant <= 19){
+                unsigned long long u = 0;
+                size_t idx = significant;
+                for(std::uint64_t v; idx + 8 <= last; idx += 8){
+                    std::memcpy(&v, s + idx, 8);
+                    u = u * 100000000ull + eight_digits_value(v);
+                }
+                for(; idx < last; ++idx){
+                    u = u * 10 + static_cast<unsigned>(s[idx] - '0');
+                }
+                return detail::integer_result<T>(parse_uint{u, u > detail::integer_limit<T>(negative)}, negative, last);
+            }
+        }
+#endif
+        return detail::to_integer_constexpr<T>(s, n, base, negative);
+    }
+
+    template<class T, class Char>
+    inline constexpr
+    parse_result<T> to_integer(Char const* s, size_t n, int base)
+    {
+        return base < 2 || base > 36 ? throw std::invalid_argument("base must be in [2, 36]") :
+               FROZEN_IS_CONSTANT_EVALUATED() ?
+                   detail::to_integer_constexpr<T>(s, n, static_cast<unsigned>(base), std::is_signed<T>::value && n > 0 && s[0] == '-') :
+                   detail::to_integer_runtime<T>(s, n, static_cast<unsigned>(base), std::is_signed<T>::value && n > 0 && s[0] == '-');
+    }
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_PARSE_HPP_INCLUDED
@@ -0,0 +1,314 @@
+#if !defined FROZEN_STRING_DETAIL_PARSE_FLOAT_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_PARSE_FLOAT_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+
+#include "./macros.hpp"
+#include "./carray.hpp"
+#include "./bignum.hpp"
+#include "./shortest.hpp"
+#include "./parse.hpp"
+#if __cplusplus >= 201703L
+#   include <charconv>
+#endif
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    // Decimal to binary conversion with correct rounding (to nearest, ties to
+    // even), like std::from_chars(first, last, value) in the general format.
+    //
+    // The significant digits and the power of ten are kept as exact big
+    // integers and the quotient is computed bit by bit, so it works in relaxed
+    // constexpr for any radix-2 floating point type.
+
+    template<class Float>
+    struct float_parse_traits{
+        typedef float_traits<Float> traits;
+
+        // the longest decimal expansion of a halfway point between two floats;
+        // the digits after it only decide the rounding as a sticky digit
+        static constexpr size_t max_significant =
+            (1 - traits::min_exp) - ((-(traits::min_exp + traits::digits)) * 30103) / 100000 + 1;
+
+        // v = 0.d1d2... * 10^k with k < min_k rounds to zero, with k > max_k to infinity
+        static constexpr int min_k = ((traits::min_exp - 1) * 30103) / 100000 - 1;
+        static constexpr int max_k = std::numeric_limits<Float>::max_exponent10 + 1;
+
+        static constexpr size_t bignum_bits =
+            ((max_significant + 2 - min_k) * 3322) / 1000 - traits::min_exp + 2 * traits::digits + 128;
+        typedef bignum<bignum_bits / 32 + 1> bignum_type;
+    };
+
+    template<class Char>
+    inline constexpr bool match_icase(Char const* s, size_t idx, size_t n, char const* word, size_t len)
+    {
+        if(n - idx < len){
+            return false;
+        }
+        for(size_t i = 0; i < len; ++i){
+            Char const c = s[idx + i];
+            if(c != word[i] && c != word[i] - 'a' + 'A'){
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class Float>
+    inline constexpr Float float_of(typename float_parse_traits<Float>::bignum_type const& b)
+    {
+        // b < 2^digits, so every step is exact
+        Float f = 0;
+        for(size_t i = b.limb_size(); i > 0; --i){
+            f = f * pow2_float<Float>(32) + static_cast<Float>(b.limb(i-1));
+        }
+        return f;
+    }
+
+    // @brief: the float nearest to d * 10^e; d is not zero
+    template<class Float>
+    inline constexpr parse_result<Float> float_from_decimal(typename float_parse_traits<Float>::bignum_type d, int e, size_t pos, bool negative)
+    {
+        typedef float_traits<Float> traits;
+        typedef typename float_parse_traits<Float>::bignum_type big;
+
+        Float const sign = negative ? -1 : 1;
+        parse_result<Float> const overflow{sign * std::numeric_limits<Float>::infinity(), pos, std::errc::result_out_of_range};
+        parse_result<Float> const underflow{sign * 0, pos, std::errc::result_out_of_range};
+
+        // q * 2^-s is the result, r / den the rest of the quotient
+        big q, num = d, den(1);
+        int s = 0;
+        if(e >= 0){
+            num.mul_pow10(static_cast<size_t>(e));
+            int const bits = static_cast<int>(num.bit_length());
+            s = bits > traits::digits ? traits::digits - bits : 0;
+        }else{
+            den.mul_pow10(static_cast<size_t>(-e));
+            // q has digits-1 or digits bits
+            s = traits::digits - 1 + static_cast<int>(den.bit_length()) - static_cast<int>(num.bit_length());
+            if(s > -traits::min_exp){
+                s = -traits::min_exp;
+            }
+        }
+        if(s >= 0){
+            num.shift_left(static_cast<size_t>(s));
+        }else{
+            den.shift_left(static_cast<size_t>(-s));
+        }
+
+        for(int bit = traits::digits - 1; bit >= 0; --bit){
+            big t = den;
+            t.shift_left(static_cast<size_t>(bit));
+            q.shift_left(1);
+            if(compare(num, t) >= 0){
+                num.sub(t);
+                q.add(big(1));
+            }
+        }
+        if(static_cast<int>(q.bit_length()) < traits::digits && s < -traits::min_exp && e < 0){
+            num.shift_left(1);
+            q.shift_left(1);
+            if(compare(num, den) >= 0){
+                num.sub(den);
+                q.add(big(1));
+            }
+            ++s;
+        }
+
+        num.shift_left(1);
+        int const half = compare(num, den);
+        if(half > 0 || (half == 0 && q.is_odd())){
+            q.add(big(1));
+            if(static_cast<int>(q.bit_length()) > traits::digits){
+                q.shift_right(1);
+                --s;
+            }
+        }
+
+        if(q.is_zero()){
+            return underflow;
+        }
+        if(-s > traits::max_exp - traits::digits){
+            return overflow;
+        }
+        return {sign * float_of<Float>(q) * pow2_float<Float>(-s), pos, std::errc()};
+    }
+
+    // the significant digits d1d2...dn as a big integer, nine digits at a time
+    template<class Float>
+    struct decimal_significand{
+        typedef float_parse_traits<Float> parse_traits;
+        typedef typename parse_traits::bignum_type big;
+
+        big value;
+        size_t size;
+        bool sticky;
+        std::uint32_t chunk;
+        std::uint32_t chunk_scale;
+
+        constexpr void push(unsigned digit)
+        {
+            if(size == parse_traits::max_significant){
+                sticky = sticky || digit != 0;
+                return;
+            }
+            chunk = chunk * 10 + digit;
+            chunk_scale = chunk_scale ? chunk_scale * 10 : 10;
+            ++size;
+            if(chunk_scale == 1000000000u){
+                flush();
+            }
+        }
+
+        constexpr void finish()
+        {
+            // digits beyond max_significant only break ties
+            if(sticky){
+                sticky = false;
+                ++size;
+                chunk = chunk * 10 + 1;
+                chunk_scale = chunk_scale ? chunk_scale * 10 : 10;
+            }
+            flush();
+        }
+
+    private:
+        constexpr void flush()
+        {
+            if(chunk_scale){
+                value.mul_small(chunk_scale);
+                value.add(big(chunk));
+            }
+            chunk = 0;
+            chunk_scale = 0;
+        }
+    };
+
+    template<class Float, class Char>
+    inline constexpr parse_result<Float> to_floating_constexpr(Char const* s, size_t n)
+    {
+        typedef float_parse_traits<Float> parse_traits;
+
+        size_t i = 0;
+        bool const negative = n > 0 && s[0] == '-';
+        if(negative){
+            ++i;
+        }
+        Float const sign = negative ? -1 : 1;
+
+        if(match_icase(s, i, n, "infinity", 8)){
+            return {sign * std::numeric_limits<Float>::infinity(), i + 8, std::errc()};
+        }
+        if(match_icase(s, i, n, "inf", 3)){
+            return {sign * std::numeric_limits<Float>::infinity(), i + 3, std::errc()};
+        }
+        if(match_icase(s, i, n, "nan", 3)){
+            size_t pos = i + 3;
+            if(pos < n && s[pos] == '('){
+                size_t j = pos + 1;
+                for(; j < n && (detail::digit36_of(s[j]) < 36 || s[j] == '_'); ++j){}
+                if(j < n && s[j] == ')'){
+                    pos = j + 1;
+                }
+            }
+            return {sign * std::numeric_limits<Float>::quiet_NaN(), pos, std::errc()};
+        }
+
+        // v = 0.d1d2...dn * 10^k
+        decimal_significand<Float> d{};
+        int k = 0;
+        bool any_digit = false;
+
+        for(; i < n && s[i] >= '0' && s[i] <= '9'; ++i){
+            any_digit = true;
+            if(d.size != 0 || s[i] != '0'){
+                d.push(static_cast<unsigned>(s[i] - '0'));
+                ++k;
+            }
+        }
+        if(i < n && s[i] == '.'){
+            for(++i; i < n && s[i] >= '0' && s[i] <= '9'; ++i){
+                any_digit = true;
+                if(d.size != 0 || s[i] != '0'){
+                    d.push(static_cast<unsigned>(s[i] - '0'));
+                }else{
+                    --k;
+                }
+            }
+        }
+        if(!any_digit){
+            return {Float(), 0, std::errc::invalid_argument};
+        }
+
+        if(i < n && (s[i] == 'e' || s[i] == 'E')){
+            size_t j = i + 1;
+            bool const exp_negative = j < n && s[j] == '-';
+            if(j < n && (s[j] == '-' || s[j] == '+')){
+                ++j;
+            }
+            if(j < n && s[j] >= '0' && s[j] <= '9'){
+                int exp = 0;
+                for(; j < n && s[j] >= '0' && s[j] <= '9'; ++j){
+                    exp = exp < 100000 ? exp * 10 + (s[j] - '0') : exp;
+                }
+                k += exp_negative ? -exp : exp;
+                i = j;
+            }
+        }
+
+        d.finish();
+        if(d.size == 0){
+            return {sign * 0, i, std::errc()};
+        }
+        if(k < parse_traits::min_k){
+            return {sign * 0, i, std::errc::result_out_of_range};
+        }
+        if(k > parse_traits::max_k){
+            return {sign * std::numeric_limits<Float>::infinity(), i, std::errc::result_out_of_range};
+        }
+        return float_from_decimal<Float>(d.value, k - static_cast<int>(d.size), i, negative);
+    }
+
+#if defined __cpp_lib_to_chars && __cpp_lib_to_chars >= 201611L
+    // std::from_chars() for char; errors are reported by the constexpr version
+    // so that the value is the same as at compile-time
+    template<class Float, class Char>
+    inline parse_result<Float> to_floating_runtime(Char const* s, size_t n)
+    {
+        if(std::is_same<Char, char>::value){
+            Float value{};
+            char const* const first = reinterpret_cast<char const*>(s);
+            std::from_chars_result const r = std::from_chars(first, first + n, value);
+            if(r.ec == std::errc()){
+                return {value, static_cast<size_t>(r.ptr - first), std::errc()};
+            }
+        }
+        return to_floating_constexpr<Float>(s, n);
+    }
+#else
+    template<class Float, class Char>
+    inline parse_result<Float> to_floating_runtime(Char const* s, size_t n)
+    {
+        return to_floating_constexpr<Float>(s, n);
+    }
+#endif
+
+    template<class Float, class Char>
+    inline constexpr parse_result<Float> to_floating(Char const* s, size_t n)
+    {
+        return FROZEN_IS_CONSTANT_EVALUATED() ?
+                   to_floating_constexpr<Float>(s, n) :
+                   to_floating_runtime<Float>(s, n);
+    }
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_PARSE_FLOAT_HPP_INCLUDED
@@ -0,0 +1,137 @@
+#if !defined FROZEN_STRING_DETAIL_PMH_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_PMH_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "../../type_traits_aliases.hpp"
+#include "./macros.hpp"
+#include "./carray.hpp"
+#include "./util.hpp"
+
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    inline constexpr size_t pmh_bit_ceil(size_t n)
+    {
+        return n <= 1 ? 1 : 2 * pmh_bit_ceil((n + 1) / 2);
+    }
+
+    inline constexpr std::uint64_t pmh_mix_step(std::uint64_t x, unsigned shift)
+    {
+        return x ^ (x >> shift);
+    }
+
+    // splitmix64 finalizer
+    inline constexpr std::uint64_t pmh_mix(std::uint64_t h, std::uint64_t seed)
+    {
+        return pmh_mix_step(pmh_mix_step(pmh_mix_step(h ^ (seed * 0x9e3779b97f4a7c15ull), 30) * 0xbf58476d1ce4e5b9ull, 27) * 0x94d049bb133111ebull, 31);
+    }
+
+    // Hash-and-displace perfect hash of N 64bit hashes.
+    //
+    // Each hash belongs to the bucket (h % Buckets).  Every bucket has a seed
+    // chosen at compile-time such that pmh_mix(h, seed) of its members land on
+    // distinct free slots.  Lookup is therefore one bucket read, one mix and
+    // one slot read; the slot holds the index of the only candidate (or N).
+    template<size_t N>
+    class pmh_table{
+    public:
+        static constexpr size_t buckets = N / 2 + 1;
+        static constexpr size_t slots = pmh_bit_ceil(N);
+        static constexpr size_t empty = N;
+        static constexpr std::uint32_t max_seed = 1u << 20;
+
+        typedef uint_least_for<N> index_type;
+
+        constexpr explicit pmh_table(carray<std::uint64_t, N> const& hashes)
+            : seeds_{}, slots_{}
+        {
+            for(size_t s = 0; s < slots; ++s){
+                slots_[s] = static_cast<index_type>(empty);
+            }
+
+            // group the items by bucket (counting sort)
+            carray<size_t, buckets + 1> start{};
+            for(size_t i = 0; i < N; ++i){
+                ++start[hashes[i] % buckets + 1];
+            }
+            for(size_t b = 0; b < buckets; ++b){
+                start[b+1] += start[b];
+            }
+            carray<size_t, N> members{};
+            carray<size_t, buckets> filled{};
+            for(size_t i = 0; i < N; ++i){
+                size_t const b = hashes[i] % buckets;
+                members[start[b] + filled[b]++] = i;
+            }
+
+            // place the largest buckets first while most slots are still free
+            carray<size_t, N + 2> by_size{};
+            for(size_t b = 0; b < buckets; ++b){
+                ++by_size[N - (start[b+1] - start[b]) + 1];
+            }
+            for(size_t k = 0; k <= N; ++k){
+                by_size[k+1] += by_size[k];
+            }
+            carray<size_t, buckets> order{};
+            for(size_t b = 0; b < buckets; ++b){
+                order[by_size[N - (start[b+1] - start[b])]++] = b;
+            }
+            for(size_t i = 0; i < buckets; ++i){
+                size_t const b = order[i];
+                place(hashes, members, start[b], start[b+1], b);
+            }
+        }
+
+        // @brief: index of the only item which may have the hash h, or N.
+        constexpr size_t lookup(std::uint64_t h) const
+        {
+            return slots_[pmh_mix(h, seeds_[h % buckets]) & (slots - 1)];
+        }
+
+    private:
+        constexpr void place(carray<std::uint64_t, N> const& hashes, carray<size_t, N> const& members,
+                             size_t first, size_t last, size_t bucket)
+        {
+            for(size_t i = first; i < last; ++i){
+                for(size_t j = first; j < i; ++j){
+                    if(hashes[members[i]] == hashes[members[j]]){
+                        throw std::invalid_argument("duplicate key in perfect hash table");
+                    }
+                }
+            }
+
+            for(std::uint32_t seed = 0; seed < max_seed; ++seed){
+                size_t placed = first;
+                for(; placed < last; ++placed){
+                    size_t const s = pmh_mix(hashes[members[placed]], seed) & (slots - 1);
+                    if(slots_[s] != empty){
+                        break;
+                    }
+                    slots_[s] = static_cast<index_type>(members[placed]);
+                }
+                if(placed == last){
+                    seeds_[bucket] = seed;
+                    return;
+                }
+                // roll back the partially placed bucket
+                for(size_t i = first; i < placed; ++i){
+                    slots_[pmh_mix(hashes[members[i]], seed) & (slots - 1)] = static_cast<index_type>(empty);
+                }
+            }
+            throw std::logic_error("no perfect hash seed found");
+        }
+
+        carray<std::uint32_t, buckets> seeds_;
+        carray<index_type, slots> slots_;
+    };
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_PMH_HPP_INCLUDED
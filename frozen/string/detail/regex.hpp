@@ -0,0 +1,784 @@
+#if !defined FROZEN_STRING_DETAIL_REGEX_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_REGEX_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "./macros.hpp"
+#include "./carray.hpp"
+
+// the subset construction fails with "regex: too many DFA states" beyond this
+#if !defined FROZEN_REGEX_MAX_DFA_STATES
+#    define FROZEN_REGEX_MAX_DFA_STATES 256
+#endif
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    // A regular expression is compiled in stages, each of which gives the
+    // sizes of the next one:
+    //
+    //   1. regex_counter:  the number of positions (the character sets, once
+    //                      the bounded repeats are unrolled) and of ranges
+    //   2. regex_glushkov: the Glushkov automaton of the positions, and the
+    //                      classes of characters which no set tells apart
+    //   3. regex_dfa:      the subset construction over the classes,
+    //                      minimized by partition refinement
+    //
+    // The syntax is a subset of ECMAScript: literals, '.', escapes (\d \w \s
+    // \D \W \S \n \t \r \f \v \0 and punctuation), [classes] with ranges and
+    // negation, (groups), (?:groups), '|', '*', '+', '?', {m}, {m,}, {m,n},
+    // and '^' or '$' around the whole pattern.
+
+    typedef unsigned long long regex_code;
+
+    template<class Char>
+    inline constexpr regex_code regex_code_of(Char c) noexcept
+    {
+        return static_cast<typename std::make_unsigned<Char>::type>(c);
+    }
+
+    template<class Char>
+    inline constexpr regex_code regex_max_code() noexcept
+    {
+        return std::numeric_limits<typename std::make_unsigned<Char>::type>::max();
+    }
+
+    struct regex_range{
+        regex_code lo;
+        regex_code hi;
+    };
+
+    // a set of characters; sorted disjoint ranges once normalized
+    template<size_t K>
+    struct regex_class{
+        carray<regex_range, K> ranges;
+        size_t size;
+
+        constexpr void add(regex_code lo, regex_code hi)
+        {
+            if(size == K){
+                throw std::invalid_argument("regex: character class too large");
+            }
+            ranges[size++] = regex_range{lo, hi};
+        }
+
+        template<size_t M>
+        constexpr void add(regex_class<M> const& other)
+        {
+            for(size_t i = 0; i < other.size; ++i){
+                add(other.ranges[i].lo, other.ranges[i].hi);
+            }
+        }
+
+        constexpr void normalize(bool negate, regex_code max)
+        {
+            for(size_t i = 1; i < size; ++i){
+                regex_range const r = ranges[i];
+                size_t j = i;
+                for(; j > 0 && r.lo < ranges[j-1].lo; --j){
+                    ranges[j] = ranges[j-1];
+                }
+                ranges[j] = r;
+            }
+            size_t merged = 0;
+            for(size_t i = 0; i < size; ++i){
+                if(merged > 0 && ranges[i].lo <= ranges[merged-1].hi + 1){
+                    if(ranges[i].hi > ranges[merged-1].hi){
+                        ranges[merged-1].hi = ranges[i].hi;
+                    }
+                }else{
+                    ranges[merged++] = ranges[i];
+                }
+            }
+            size = merged;
+
+            if(negate){
+                regex_class const set = *this;
+                size = 0;
+                regex_code next = 0;
+                for(size_t i = 0; i < set.size; ++i){
+                    if(set.ranges[i].lo > next){
+                        add(next, set.ranges[i].lo - 1);
+                    }
+                    next = set.ranges[i].hi + 1;
+                }
+                if(next <= max){
+                    add(next, max);
+                }
+            }
+        }
+    };
+
+    // a character or a class escape adds at most two and a half ranges per
+    // character of the pattern
+    template<size_t N>
+    struct regex_class_capacity : std::integral_constant<size_t, 3 * N + 2>
+    {};
+
+    template<size_t Bits>
+    struct regex_bitset{
+        carray<std::uint64_t, (Bits + 63) / 64> words;
+
+        constexpr void set(size_t idx)
+        {
+            words[idx / 64] |= std::uint64_t(1) << (idx % 64);
+        }
+
+        constexpr bool test(size_t idx) const
+        {
+            return ((words[idx / 64] >> (idx % 64)) & 1) != 0;
+        }
+
+        constexpr void merge(regex_bitset const& other)
+        {
+            for(size_t w = 0; w < words.size(); ++w){
+                words[w] |= other.words[w];
+            }
+        }
+
+        constexpr regex_bitset intersection(regex_bitset const& other) const
+        {
+            regex_bitset r{};
+            for(size_t w = 0; w < words.size(); ++w){
+                r.words[w] = words[w] & other.words[w];
+            }
+            return r;
+        }
+
+        constexpr bool any() const
+        {
+            for(size_t w = 0; w < words.size(); ++w){
+                if(words[w] != 0){
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        constexpr bool equals(regex_bitset const& other) const
+        {
+            for(size_t w = 0; w < words.size(); ++w){
+                if(words[w] != other.words[w]){
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    // stage 1: the sizes of the Glushkov automaton
+    struct regex_counter{
+        struct fragment{};
+
+        size_t positions;
+        size_t ranges;
+
+        template<class Class>
+        constexpr fragment atom(Class const& c)
+        {
+            ++positions;
+            ranges += c.size;
+            return {};
+        }
+
+        constexpr fragment empty() const { return {}; }
+        constexpr fragment concat(fragment, fragment) const { return {}; }
+        constexpr fragment alternate(fragment, fragment) const { return {}; }
+        constexpr fragment star(fragment) const { return {}; }
+        constexpr fragment plus(fragment) const { return {}; }
+        constexpr fragment optional(fragment) const { return {}; }
+    };
+
+    // stage 2: position 0 is the initial state and follow[p] the positions
+    // which can come after p
+    template<size_t P, size_t R>
+    struct regex_glushkov{
+        typedef regex_bitset<P + 1> set_type;
+
+        struct fragment{
+            bool nullable;
+            set_type first;
+            set_type last;
+        };
+
+        size_t positions;
+        carray<size_t, P + 1> range_begin;
+        carray<size_t, P + 1> range_end;
+        carray<regex_range, R> ranges;
+        size_t range_count;
+        carray<set_type, P + 1> follow;
+        set_type accepting;
+
+        // the ranges split the characters into intervals, and intervals
+        // which the same positions match make a class
+        carray<regex_code, 2 * R + 1> interval_starts;
+        size_t intervals;
+        carray<size_t, 2 * R + 1> interval_class;
+        carray<set_type, 2 * R + 1> members;
+        size_t classes;
+
+        bool anchored_begin;
+        bool anchored_end;
+
+        template<class Class>
+        constexpr fragment atom(Class const& c)
+        {
+            size_t const p = ++positions;
+            range_begin[p] = range_count;
+            for(size_t i = 0; i < c.size; ++i){
+                ranges[range_count++] = c.ranges[i];
+            }
+            range_end[p] = range_count;
+
+            fragment f{};
+            f.first.set(p);
+            f.last.set(p);
+            return f;
+        }
+
+        constexpr fragment empty() const
+        {
+            fragment f{};
+            f.nullable = true;
+            return f;
+        }
+
+        constexpr fragment concat(fragment const& a, fragment const& b)
+        {
+            link(a.last, b.first);
+            fragment f = a;
+            f.nullable = a.nullable && b.nullable;
+            if(a.nullable){
+                f.first.merge(b.first);
+            }
+            f.last = b.last;
+            if(b.nullable){
+                f.last.merge(a.last);
+            }
+            return f;
+        }
+
+        constexpr fragment alternate(fragment const& a, fragment const& b) const
+        {
+            fragment f = a;
+            f.nullable = a.nullable || b.nullable;
+            f.first.merge(b.first);
+            f.last.merge(b.last);
+            return f;
+        }
+
+        constexpr fragment star(fragment const& a)
+        {
+            fragment f = plus(a);
+            f.nullable = true;
+            return f;
+        }
+
+        constexpr fragment plus(fragment const& a)
+        {
+            link(a.last, a.first);
+            return a;
+        }
+
+        constexpr fragment optional(fragment const& a) const
+        {
+            fragment f = a;
+            f.nullable = true;
+            return f;
+        }
+
+        constexpr void link(set_type const& from, set_type const& to)
+        {
+            for(size_t p = 0; p <= positions; ++p){
+                if(from.test(p)){
+                    follow[p].merge(to);
+                }
+            }
+        }
+
+        constexpr void finish(fragment const& f, regex_code max)
+        {
+            follow[0] = f.first;
+            accepting = f.last;
+            if(f.nullable){
+                accepting.set(0);
+            }
+
+            // every range begins and ends on an interval boundary
+            interval_starts[0] = 0;
+            intervals = 1;
+            for(size_t i = 0; i < range_count; ++i){
+                add_interval_start(ranges[i].lo);
+                if(ranges[i].hi < max){
+                    add_interval_start(ranges[i].hi + 1);
+                }
+            }
+
+            classes = 0;
+            for(size_t k = 0; k < intervals; ++k){
+                set_type matching{};
+                for(size_t p = 1; p <= positions; ++p){
+                    for(size_t r = range_begin[p]; r < range_end[p]; ++r){
+                        if(interval_starts[k] >= ranges[r].lo && interval_starts[k] <= ranges[r].hi){
+                            matching.set(p);
+                        }
+                    }
+                }
+                size_t c = 0;
+                for(; c < classes && !members[c].equals(matching); ++c){}
+                if(c == classes){
+                    members[classes++] = matching;
+                }
+                interval_class[k] = c;
+            }
+        }
+
+        constexpr void add_interval_start(regex_code c)
+        {
+            size_t j = intervals;
+            for(; j > 0 && c < interval_starts[j-1]; --j){}
+            if(j > 0 && interval_starts[j-1] == c){
+                return;
+            }
+            for(size_t k = intervals; k > j; --k){
+                interval_starts[k] = interval_starts[k-1];
+            }
+            interval_starts[j] = c;
+            ++intervals;
+        }
+    };
+
+    // recursive descent over the pattern, reporting to a stage 1 or 2 sink
+    template<class Char, class Sink, size_t K>
+    struct regex_parser{
+        typedef typename Sink::fragment fragment;
+        typedef regex_class<K> class_type;
+
+        Char const* s;
+        size_t n;
+        size_t i;
+        size_t depth;
+        bool top_alternation;
+        bool anchored_begin;
+        bool anchored_end;
+        Sink sink;
+
+        constexpr fragment parse()
+        {
+            fragment const f = parse_alternation();
+            if(i != n){
+                throw std::invalid_argument("regex: unmatched ')'");
+            }
+            if((anchored_begin || anchored_end) && top_alternation){
+                throw std::invalid_argument("regex: '^' and '$' must apply to the whole pattern");
+            }
+            return f;
+        }
+
+        constexpr fragment parse_alternation()
+        {
+            fragment f = parse_concatenation();
+            while(i < n && s[i] == '|'){
+                ++i;
+                top_alternation = top_alternation || depth == 0;
+                f = sink.alternate(f, parse_concatenation());
+            }
+            return f;
+        }
+
+        constexpr fragment parse_concatenation()
+        {
+            fragment f = sink.empty();
+            while(i < n && s[i] != '|' && s[i] != ')'){
+                if(s[i] == '^'){
+                    if(i != 0){
+                        throw std::invalid_argument("regex: '^' is only supported at the beginning");
+                    }
+                    anchored_begin = true;
+                    ++i;
+                }else if(s[i] == '$'){
+                    if(i + 1 != n){
+                        throw std::invalid_argument("regex: '$' is only supported at the end");
+                    }
+                    anchored_end = true;
+                    ++i;
+                }else{
+                    f = sink.concat(f, parse_repeat());
+                }
+            }
+            return f;
+        }
+
+        static constexpr bool is_quantifier(Char c)
+        {
+            return c == '*' || c == '+' || c == '?' || c == '{';
+        }
+
+        constexpr fragment parse_repeat()
+        {
+            size_t const begin = i;
+            fragment f = parse_atom();
+            if(i == n || !is_quantifier(s[i])){
+                return f;
+            }
+            Char const q = s[i++];
+            if(q == '*'){
+                f = sink.star(f);
+            }else if(q == '+'){
+                f = sink.plus(f);
+            }else if(q == '?'){
+                f = sink.optional(f);
+            }else{
+                size_t const lo = parse_count();
+                size_t hi = lo;
+                bool unbounded = false;
+                if(i < n && s[i] == ','){
+                    ++i;
+                    if(i < n && s[i] == '}'){
+                        unbounded = true;
+                    }else{
+                        hi = parse_count();
+                    }
+                }
+                if(i == n || s[i] != '}'){
+                    throw std::invalid_argument("regex: missing '}'");
+                }
+                ++i;
+                f = repeat(f, begin, lo, hi, unbounded);
+            }
+            if(i < n && is_quantifier(s[i])){
+                throw std::invalid_argument("regex: nothing to repeat");
+            }
+            return f;
+        }
+
+        constexpr size_t parse_count()
+        {
+            if(i == n || s[i] < '0' || s[i] > '9'){
+                throw std::invalid_argument("regex: bad repeat count");
+            }
+            size_t count = 0;
+            for(; i < n && s[i] >= '0' && s[i] <= '9'; ++i){
+                count = count * 10 + static_cast<size_t>(s[i] - '0');
+                if(count > 1000){
+                    throw std::invalid_argument("regex: repeat count is too large");
+                }
+            }
+            return count;
+        }
+
+        // the atom at begin once more, with new positions
+        constexpr fragment copy(size_t begin)
+        {
+            size_t const end = i;
+            i = begin;
+            fragment const f = parse_atom();
+            i = end;
+            return f;
+        }
+
+        // x{m,n} is m copies of x followed by n-m copies of x?,
+        // x{m,} is m-1 copies of x followed by x+
+        constexpr fragment repeat(fragment const& f, size_t begin, size_t lo, size_t hi, bool unbounded)
+        {
+            if(unbounded){
+                if(lo == 0){
+                    return sink.star(f);
+                }
+                fragment r = lo == 1 ? sink.plus(f) : f;
+                for(size_t k = 2; k <= lo; ++k){
+                    fragment const c = copy(begin);
+                    r = sink.concat(r, k == lo ? sink.plus(c) : c);
+                }
+                return r;
+            }
+            if(hi < lo){
+                throw std::invalid_argument("regex: bad repeat range");
+            }
+            if(hi == 0){
+                return sink.empty();
+            }
+            fragment r = lo == 0 ? sink.optional(f) : f;
+            for(size_t k = 2; k <= hi; ++k){
+                fragment const c = copy(begin);
+                r = sink.concat(r, k <= lo ? c : sink.optional(c));
+            }
+            return r;
+        }
+
+        constexpr fragment parse_atom()
+        {
+            Char const c = s[i];
+            if(c == '('){
+                ++i;
+                if(i + 1 < n && s[i] == '?' && s[i+1] == ':'){
+                    i += 2;
+                }
+                ++depth;
+                fragment const f = parse_alternation();
+                --depth;
+                if(i == n || s[i] != ')'){
+                    throw std::invalid_argument("regex: missing ')'");
+                }
+                ++i;
+                return f;
+            }
+            if(is_quantifier(c)){
+                throw std::invalid_argument("regex: nothing to repeat");
+            }
+
+            class_type set{};
+            ++i;
+            if(c == '['){
+                parse_class(set);
+            }else if(c == '.'){
+                set.add('\n', '\n');
+                set.normalize(true, regex_max_code<Char>());
+            }else if(c == '\\'){
+                parse_escape(set);
+                set.normalize(false, regex_max_code<Char>());
+            }else{
+                set.add(regex_code_of(c), regex_code_of(c));
+            }
+            return sink.atom(set);
+        }
+
+        static constexpr void add_named(class_type& set, Char name)
+        {
+            class_type named{};
+            Char const lower = name >= 'A' && name <= 'Z' ? static_cast<Char>(name - 'A' + 'a') : name;
+            if(lower == 'd'){
+                named.add('0', '9');
+            }else if(lower == 'w'){
+                named.add('0', '9');
+                named.add('A', 'Z');
+                named.add('_', '_');
+                named.add('a', 'z');
+            }else{
+                named.add('\t', '\r');
+                named.add(' ', ' ');
+            }
+            named.normalize(lower != name, regex_max_code<Char>());
+            set.add(named);
+        }
+
+        constexpr void parse_escape(class_type& set)
+        {
+            if(i == n){
+                throw std::invalid_argument("regex: trailing '\\'");
+            }
+            Char const e = s[i++];
+            regex_code code = regex_code_of(e);
+            if(e == 'd' || e == 'D' || e == 'w' || e == 'W' || e == 's' || e == 'S'){
+                add_named(set, e);
+                return;
+            }
+            if(e == 'n'){
+                code = '\n';
+            }else if(e == 't'){
+                code = '\t';
+            }else if(e == 'r'){
+                code = '\r';
+            }else if(e == 'f'){
+                code = '\f';
+            }else if(e == 'v'){
+                code = '\v';
+            }else if(e == '0'){
+                code = 0;
+            }else if((e >= '0' && e <= '9') || (e >= 'a' && e <= 'z') || (e >= 'A' && e <= 'Z')){
+                throw std::invalid_argument("regex: unsupported escape");
+            }
+            set.add(code, code);
+        }
+
+        // a single character of a class, or npos for a class escape added to set
+        constexpr regex_code parse_class_char(class_type& set)
+        {
+            if(s[i] != '\\'){
+                return regex_code_of(s[i++]);
+            }
+            ++i;
+            class_type item{};
+            parse_escape(item);
+            if(item.size == 1 && item.ranges[0].lo == item.ranges[0].hi){
+                return item.ranges[0].lo;
+            }
+            set.add(item);
+            return std::numeric_limits<regex_code>::max();
+        }
+
+        constexpr void parse_class(class_type& set)
+        {
+            bool const negate = i < n && s[i] == '^';
+            if(negate){
+                ++i;
+            }
+            // as in ECMAScript, [] matches nothing and [^] everything
+            while(true){
+                if(i == n){
+                    throw std::invalid_argument("regex: missing ']'");
+                }
+                if(s[i] == ']'){
+                    ++i;
+                    break;
+                }
+                regex_code const lo = parse_class_char(set);
+                if(lo == std::numeric_limits<regex_code>::max()){
+                    continue;
+                }
+                regex_code hi = lo;
+                if(i + 1 < n && s[i] == '-' && s[i+1] != ']'){
+                    ++i;
+                    hi = parse_class_char(set);
+                    if(hi == std::numeric_limits<regex_code>::max() || hi < lo){
+                        throw std::invalid_argument("regex: bad range in character class");
+                    }
+                }
+                set.add(lo, hi);
+            }
+            set.normalize(negate, regex_max_code<Char>());
+        }
+    };
+
+    template<class Char, size_t N>
+    inline constexpr regex_counter regex_count_of(Char const* s)
+    {
+        regex_parser<Char, regex_counter, regex_class_capacity<N>::value> parser{s, N, 0, 0, false, false, false, {}};
+        parser.parse();
+        return parser.sink;
+    }
+
+    template<class Char, size_t N, size_t P, size_t R>
+    inline constexpr regex_glushkov<P, R> regex_glushkov_of(Char const* s)
+    {
+        regex_parser<Char, regex_glushkov<P, R>, regex_class_capacity<N>::value> parser{s, N, 0, 0, false, false, false, {}};
+        auto const f = parser.parse();
+        parser.sink.finish(f, regex_max_code<Char>());
+        parser.sink.anchored_begin = parser.anchored_begin;
+        parser.sink.anchored_end = parser.anchored_end;
+        return parser.sink;
+    }
+
+    // stage 3: state 0 is the dead state, which every state reaches on
+    // the characters it cannot match
+    template<size_t C, size_t S>
+    struct regex_dfa{
+        size_t states;
+        size_t start;
+        carray<size_t, S * C> delta;
+        carray<bool, S> accept;
+    };
+
+    // at most 2^(P+1) sets of positions
+    template<size_t P>
+    struct regex_dfa_capacity
+        : std::integral_constant<size_t, (P + 1 < 16 && (size_t(1) << (P + 1)) < FROZEN_REGEX_MAX_DFA_STATES) ?
+                                         (size_t(1) << (P + 1)) : FROZEN_REGEX_MAX_DFA_STATES>
+    {};
+
+    template<size_t C, size_t S>
+    inline constexpr bool regex_same_block(regex_dfa<C, S> const& dfa, carray<size_t, S> const& block, size_t a, size_t b)
+    {
+        if(block[a] != block[b]){
+            return false;
+        }
+        for(size_t k = 0; k < C; ++k){
+            if(block[dfa.delta[a * C + k]] != block[dfa.delta[b * C + k]]){
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Moore's algorithm: split the accepting and the other states until the
+    // states of every block go to the same blocks
+    template<size_t C, size_t S>
+    inline constexpr regex_dfa<C, S> regex_minimize(regex_dfa<C, S> const& dfa)
+    {
+        carray<size_t, S> block{};
+        size_t blocks = 1;
+        for(size_t s = 0; s < dfa.states; ++s){
+            block[s] = dfa.accept[s] ? 1 : 0;
+            blocks = dfa.accept[s] ? 2 : blocks;
+        }
+        while(true){
+            // blocks are numbered by their first state, so the dead state stays 0
+            carray<size_t, S> next{};
+            size_t count = 0;
+            for(size_t s = 0; s < dfa.states; ++s){
+                size_t t = 0;
+                for(; t < s && !regex_same_block(dfa, block, t, s); ++t){}
+                next[s] = t < s ? next[t] : count++;
+            }
+            block = next;
+            if(count == blocks){
+                break;
+            }
+            blocks = count;
+        }
+
+        regex_dfa<C, S> r{};
+        r.states = blocks;
+        r.start = block[dfa.start];
+        for(size_t s = 0; s < dfa.states; ++s){
+            r.accept[block[s]] = dfa.accept[s];
+            for(size_t k = 0; k < C; ++k){
+                r.delta[block[s] * C + k] = block[dfa.delta[s * C + k]];
+            }
+        }
+        return r;
+    }
+
+    // an unanchored DFA keeps position 0 in every set, as if the pattern
+    // began with .*, and has no states if it needs more than S of them
+    template<size_t C, size_t S, size_t P, size_t R>
+    inline constexpr regex_dfa<C, S> regex_dfa_of(regex_glushkov<P, R> const& g, bool unanchored = false)
+    {
+        typedef typename regex_glushkov<P, R>::set_type set_type;
+
+        carray<set_type, S> sets{};
+        regex_dfa<C, S> dfa{};
+        sets[1].set(0);
+        dfa.start = 1;
+        dfa.states = 2;
+        for(size_t u = 1; u < dfa.states; ++u){
+            set_type reach{};
+            for(size_t p = 0; p <= g.positions; ++p){
+                if(sets[u].test(p)){
+                    reach.merge(g.follow[p]);
+                }
+            }
+            for(size_t k = 0; k < C; ++k){
+                set_type next = reach.intersection(g.members[k]);
+                if(unanchored){
+                    next.set(0);
+                }
+                size_t v = 0;
+                for(; v < dfa.states && !sets[v].equals(next); ++v){}
+                if(v == dfa.states){
+                    if(v == S && unanchored){
+                        return regex_dfa<C, S>{};
+                    }
+                    if(v == S){
+                        throw std::invalid_argument("regex: too many DFA states");
+                    }
+                    sets[v] = next;
+                    ++dfa.states;
+                }
+                dfa.delta[u * C + k] = v;
+            }
+            dfa.accept[u] = sets[u].intersection(g.accepting).any();
+        }
+        return regex_minimize(dfa);
+    }
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_REGEX_HPP_INCLUDED
@@ -0,0 +1,298 @@
+#if !defined FROZEN_STRING_DETAIL_SEARCH_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_SEARCH_HPP_INCLUDED
+
+#include <cstddef>
+#include <string>
+
+#include "./macros.hpp"
+#include "./compare.hpp"
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    namespace impl {
+
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+        // the first index in [first, last) which satisfies pred, or npos
+        template<class Pred>
+        inline constexpr
+        size_t find_if_impl(Pred const& pred, size_t first, size_t last)
+        {
+            for(; first < last; ++first){
+                if(pred(first)){
+                    return first;
+                }
+            }
+            return npos;
+        }
+
+        // the last index in [first, last) which satisfies pred, or npos
+        template<class Pred>
+        inline constexpr
+        size_t find_last_if_impl(Pred const& pred, size_t first, size_t last)
+        {
+            for(; last > first; --last){
+                if(pred(last - 1)){
+                    return last - 1;
+                }
+            }
+            return npos;
+        }
+#else
+        template<class Pred>
+        inline constexpr
+        size_t find_if_impl(Pred const& pred, size_t first, size_t last);
+
+        template<class Pred>
+        inline constexpr
+        size_t find_if_right(Pred const& pred, size_t found, size_t mid, size_t last)
+        {
+            return found != npos ? found : find_if_impl(pred, mid, last);
+        }
+
+        // the first index in [first, last) which satisfies pred, or npos.
+        // bisect so that the recursion depth is O(log N)
+        template<class Pred>
+        inline constexpr
+        size_t find_if_impl(Pred const& pred, size_t first, size_t last)
+        {
+            return last - first == 0 ? npos :
+                   last - first == 1 ? (pred(first) ? first : npos) :
+                   find_if_right(pred, find_if_impl(pred, first, first + (last-first)/2), first + (last-first)/2, last);
+        }
+
+        template<class Pred>
+        inline constexpr
+        size_t find_last_if_impl(Pred const& pred, size_t first, size_t last);
+
+        template<class Pred>
+        inline constexpr
+        size_t find_last_if_left(Pred const& pred, size_t first, size_t mid, size_t found)
+        {
+            return found != npos ? found : find_last_if_impl(pred, first, mid);
+        }
+
+        // the last index in [first, last) which satisfies pred, or npos
+        template<class Pred>
+        inline constexpr
+        size_t find_last_if_impl(Pred const& pred, size_t first, size_t last)
+        {
+            return last - first == 0 ? npos :
+                   last - first == 1 ? (pred(first) ? first : npos) :
+                   find_last_if_left(pred, first, first + (last-first)/2, find_last_if_impl(pred, first + (last-first)/2, last));
+        }
+#endif
+
+        template<class Char>
+        struct char_is{
+            Char const* s;
+            Char c;
+
+            constexpr bool operator()(size_t idx) const
+            {
+                return s[idx] == c;
+            }
+        };
+
+        template<class Char>
+        struct substr_is{
+            Char const* s;
+            Char const* needle;
+            size_t size;
+
+            constexpr bool operator()(size_t idx) const
+            {
+                return mismatch_impl(s + idx, needle, 0, size) == size;
+            }
+        };
+
+        // s[idx] is (or is not, if !in) one of set
+        template<class Char>
+        struct char_in{
+            Char const* s;
+            Char const* set;
+            size_t size;
+            bool in;
+
+            constexpr bool operator()(size_t idx) const
+            {
+                return (find_if_impl(char_is<Char>{set, s[idx]}, 0, size) != npos) == in;
+            }
+        };
+
+        template<class Char>
+        inline constexpr
+        size_t find_constexpr(Char const* s, size_t n, Char const* needle, size_t m, size_t pos)
+        {
+            return m > n || pos > n - m ? npos :
+                   find_if_impl(substr_is<Char>{s, needle, m}, pos, n - m + 1);
+        }
+
+        template<class Char>
+        inline constexpr
+        size_t rfind_constexpr(Char const* s, size_t n, Char const* needle, size_t m, size_t pos)
+        {
+            return m > n ? npos :
+                   find_last_if_impl(substr_is<Char>{s, needle, m}, 0, (pos < n - m ? pos : n - m) + 1);
+        }
+
+        template<class Char>
+        inline constexpr
+        size_t find_of_constexpr(Char const* s, size_t n, Char const* set, size_t m, size_t pos, bool in)
+        {
+            return pos >= n ? npos : find_if_impl(char_in<Char>{s, set, m, in}, pos, n);
+        }
+
+        template<class Char>
+        inline constexpr
+        size_t find_last_of_constexpr(Char const* s, size_t n, Char const* set, size_t m, size_t pos, bool in)
+        {
+            return n == 0 ? npos : find_last_if_impl(char_in<Char>{s, set, m, in}, 0, (pos < n - 1 ? pos : n - 1) + 1);
+        }
+
+        // char_traits<>::find() is memchr() or wmemchr(), which the C library vectorizes;
+        // candidates are found by their first character and then compared
+        template<class Char>
+        inline
+        size_t find_runtime(Char const* s, size_t n, Char const* needle, size_t m, size_t pos)
+        {
+            typedef std::char_traits<Char> traits;
+            if(m > n || pos > n - m){
+                return npos;
+            }
+            if(m == 0){
+                return pos;
+            }
+            Char const* const last = s + (n - m + 1);
+            for(Char const* p = s + pos; (p = traits::find(p, static_cast<size_t>(last - p), needle[0])) != nullptr; ++p){
+                if(traits::compare(p + 1, needle + 1, m - 1) == 0){
+                    return static_cast<size_t>(p - s);
+                }
+            }
+            return npos;
+        }
+
+        template<class Char>
+        inline
+        size_t rfind_runtime(Char const* s, size_t n, Char const* needle, size_t m, size_t pos)
+        {
+            typedef std::char_traits<Char> traits;
+            if(m > n){
+                return npos;
+            }
+            for(size_t idx = (pos < n - m ? pos : n - m) + 1; idx > 0; --idx){
+                if(traits::compare(s + idx - 1, needle, m) == 0){
+                    return idx - 1;
+                }
+            }
+            return npos;
+        }
+
+        // one-byte characters are looked up in a table of the set
+        template<class Char>
+        struct char_set{
+            bool table[256];
+            Char const* set;
+            size_t size;
+
+            char_set(Char const* s, size_t n) noexcept
+                : table(), set(s), size(n)
+            {
+                if(sizeof(Char) == 1){
+                    for(size_t i = 0; i < n; ++i){
+                        table[static_cast<unsigned char>(s[i])] = true;
+                    }
+                }
+            }
+
+            bool contains(Char c) const noexcept
+            {
+                return sizeof(Char) == 1 ?
+                           table[static_cast<unsigned char>(c)] :
+                           std::char_traits<Char>::find(set, size, c) != nullptr;
+            }
+        };
+
+        template<class Char>
+        inline
+        size_t find_of_runtime(Char const* s, size_t n, Char const* set, size_t m, size_t pos, bool in)
+        {
+            if(in && m == 1){
+                Char const* const p = pos < n ? std::char_traits<Char>::find(s + pos, n - pos, set[0]) : nullptr;
+                return p ? static_cast<size_t>(p - s) : npos;
+            }
+            char_set<Char> const table(set, m);
+            for(size_t idx = pos; idx < n; ++idx){
+                if(table.contains(s[idx]) == in){
+                    return idx;
+                }
+            }
+            return npos;
+        }
+
+        template<class Char>
+        inline
+        size_t find_last_of_runtime(Char const* s, size_t n, Char const* set, size_t m, size_t pos, bool in)
+        {
+            if(n == 0){
+                return npos;
+            }
+            char_set<Char> const table(set, m);
+            for(size_t idx = (pos < n - 1 ? pos : n - 1) + 1; idx > 0; --idx){
+                if(table.contains(s[idx - 1]) == in){
+                    return idx - 1;
+                }
+            }
+            return npos;
+        }
+
+    } // namespace impl
+
+    // @brief: the first index >= pos where [needle, needle+m) begins in [s, s+n), or npos
+    template<class Char>
+    inline constexpr
+    size_t find(Char const* s, size_t n, Char const* needle, size_t m, size_t pos)
+    {
+        return FROZEN_IS_CONSTANT_EVALUATED() ?
+                   impl::find_constexpr(s, n, needle, m, pos) :
+                   impl::find_runtime(s, n, needle, m, pos);
+    }
+
+    // @brief: the last index <= pos where [needle, needle+m) begins in [s, s+n), or npos
+    template<class Char>
+    inline constexpr
+    size_t rfind(Char const* s, size_t n, Char const* needle, size_t m, size_t pos)
+    {
+        return FROZEN_IS_CONSTANT_EVALUATED() ?
+                   impl::rfind_constexpr(s, n, needle, m, pos) :
+                   impl::rfind_runtime(s, n, needle, m, pos);
+    }
+
+    // @brief: the first index >= pos whose character is (in) or is not (!in) in [set, set+m), or npos
+    template<class Char>
+    inline constexpr
+    size_t find_first_of(Char const* s, size_t n, Char const* set, size_t m, size_t pos, bool in)
+    {
+        return FROZEN_IS_CONSTANT_EVALUATED() ?
+                   impl::find_of_constexpr(s, n, set, m, pos, in) :
+                   impl::find_of_runtime(s, n, set, m, pos, in);
+    }
+
+    // @brief: the last index <= pos whose character is (in) or is not (!in) in [set, set+m), or npos
+    template<class Char>
+    inline constexpr
+    size_t find_last_of(Char const* s, size_t n, Char const* set, size_t m, size_t pos, bool in)
+    {
+        return FROZEN_IS_CONSTANT_EVALUATED() ?
+                   impl::find_last_of_constexpr(s, n, set, m, pos, in) :
+                   impl::find_last_of_runtime(s, n, set, m, pos, in);
+    }
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_SEARCH_HPP_INCLUDED
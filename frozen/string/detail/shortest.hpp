@@ -0,0 +1,375 @@
+#if !defined FROZEN_STRING_DETAIL_SHORTEST_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_SHORTEST_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "./macros.hpp"
+#include "./carray.hpp"
+#include "./bignum.hpp"
+#if __cplusplus >= 201703L
+#   include <charconv>
+#endif
+#if __cplusplus >= 202002L
+#   include <bit>
+#endif
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    // Shortest round-trip formatting of floating point numbers.
+    //
+    // The digits are generated with the free-format algorithm of Burger and
+    // Dybvig ("Printing Floating-Point Numbers Quickly and Accurately") on
+    // exact big integers, so it works in relaxed constexpr for any radix-2
+    // floating point type.  The layout follows std::to_chars(first, last, v):
+    // fixed or scientific notation, whichever is shorter (fixed on a tie).
+
+    // the number of characters of the longest result, e.g. "-1.2345678901234567e-308"
+    template<class Float>
+    struct float_shortest_max_chars{
+        static constexpr size_t exponent_digits =
+            std::numeric_limits<Float>::max_exponent10 + std::numeric_limits<Float>::max_digits10 < 100 ? 2 :
+            std::numeric_limits<Float>::max_exponent10 + std::numeric_limits<Float>::max_digits10 < 1000 ? 3 :
+            std::numeric_limits<Float>::max_exponent10 + std::numeric_limits<Float>::max_digits10 < 10000 ? 4 : 5;
+
+        // sign, digits, '.', 'e', sign of exponent and exponent
+        static constexpr size_t value = 1 + std::numeric_limits<Float>::max_digits10 + 1 + 2 + exponent_digits;
+    };
+
+    template<class Float>
+    struct float_traits{
+        typedef std::numeric_limits<Float> limits;
+
+        static constexpr int digits = limits::digits;
+        // the exponent of the least significant bit of subnormals
+        static constexpr int min_exp = limits::min_exponent - limits::digits;
+        static constexpr int max_exp = limits::max_exponent;
+
+        static constexpr size_t bignum_bits =
+            (max_exp > 2 * digits - min_exp ? max_exp : 2 * digits - min_exp) + 64;
+        typedef bignum<bignum_bits / 32 + 1> bignum_type;
+    };
+
+    // the result of formatting: characters and how many of them are used
+    template<class Float>
+    struct float_chars{
+        carray<char, float_shortest_max_chars<Float>::value> data;
+        size_t size;
+
+        constexpr void push_back(char c)
+        {
+            data[size++] = c;
+        }
+    };
+
+    template<class Float>
+    inline constexpr Float pow2_float(int exp)
+    {
+        Float f = 1;
+        for(; exp > 0; --exp){
+            f *= 2;
+        }
+        for(; exp < 0; ++exp){
+            f /= 2;
+        }
+        return f;
+    }
+
+    // v = f * 2^e.  v is finite and positive.  Every step is an exact scaling
+    // by a power of two, so no bit pattern access is needed.
+    template<class Float>
+    struct float_decomposition{
+        typedef float_traits<Float> traits;
+        typename traits::bignum_type f;
+        int e;
+
+        constexpr explicit float_decomposition(Float v)
+            : f(), e(0)
+        {
+            Float const lower = pow2_float<Float>(traits::digits - 1);
+            Float const upper = lower * 2;
+            Float const big_step = pow2_float<Float>(32);
+            while(v >= upper * big_step){
+                v /= big_step;
+                e += 32;
+            }
+            while(v >= upper){
+                v /= 2;
+                ++e;
+            }
+            while(v < lower / big_step && e - 32 >= traits::min_exp){
+                v *= big_step;
+                e -= 32;
+            }
+            while(v < lower && e > traits::min_exp){
+                v *= 2;
+                --e;
+            }
+
+            // v is an integer in [0, 2^digits); take it 32 bits at a time from the top
+            int top = (traits::digits + 31) / 32 - 1;
+            for(; top >= 0; --top){
+                Float const scale = pow2_float<Float>(top * 32);
+                std::uint32_t const limb = static_cast<std::uint32_t>(v / scale);
+                v -= static_cast<Float>(limb) * scale;
+                f.shift_left(32);
+                f.add(typename traits::bignum_type(limb));
+            }
+        }
+    };
+
+    // digits d1 d2 ... dn and k such that v = 0.d1d2...dn * 10^k
+    template<class Float>
+    struct float_digits{
+        carray<char, std::numeric_limits<Float>::max_digits10 + 1> digits;
+        size_t size;
+        int k;
+    };
+
+    // ceil(log10(2^(e + bit_length - 1))), possibly one too small or too large
+    inline constexpr int estimate_k(int e, size_t bit_length)
+    {
+        double const x = (e + static_cast<int>(bit_length) - 1) * 0.30102999566398114 - 1e-10;
+        int const t = static_cast<int>(x);
+        return t + (x > t ? 1 : 0);
+    }
+
+    template<class Float>
+    inline constexpr float_digits<Float> shortest_digits(float_decomposition<Float> const& dec)
+    {
+        typedef float_traits<Float> traits;
+        typedef typename traits::bignum_type big;
+
+        big const lowest_f = big::pow2(traits::digits - 1);
+        // the boundaries round to v itself when its mantissa is even
+        bool const is_even = !dec.f.is_odd();
+        bool const unequal_gaps = compare(dec.f, lowest_f) == 0 && dec.e > traits::min_exp;
+
+        big r, s, m_plus, m_minus;
+        if(dec.e >= 0){
+            r = dec.f;
+            r.shift_left(dec.e + (unequal_gaps ? 2 : 1));
+            s = big(unequal_gaps ? 4 : 2);
+            m_plus = big::pow2(dec.e + (unequal_gaps ? 1 : 0));
+            m_minus = big::pow2(dec.e);
+        }else{
+            r = dec.f;
+            r.shift_left(unequal_gaps ? 2 : 1);
+            s = big::pow2(-dec.e + (unequal_gaps ? 2 : 1));
+            m_plus = big(unequal_gaps ? 2 : 1);
+            m_minus = big(1);
+        }
+
+        int k = estimate_k(dec.e, dec.f.bit_length());
+        if(k >= 0){
+            s.mul_pow10(k);
+        }else{
+            r.mul_pow10(-k);
+            m_plus.mul_pow10(-k);
+            m_minus.mul_pow10(-k);
+        }
+
+        // fix up the estimate so that 0.1 <= (v + m+) / 10^k < 1
+        for(;;){
+            int const c = compare(r + m_plus, s);
+            if(is_even ? c >= 0 : c > 0){
+                s.mul_small(10);
+                ++k;
+                continue;
+            }
+            big scaled = r + m_plus;
+            scaled.mul_small(10);
+            int const c10 = compare(scaled, s);
+            if(is_even ? c10 < 0 : c10 <= 0){
+                r.mul_small(10);
+                m_plus.mul_small(10);
+                m_minus.mul_small(10);
+                --k;
+                continue;
+            }
+            break;
+        }
+
+        float_digits<Float> result{{}, 0, k};
+        for(;;){
+            r.mul_small(10);
+            m_plus.mul_small(10);
+            m_minus.mul_small(10);
+
+            char d = 0;
+            while(compare(r, s) >= 0){
+                r.sub(s);
+                ++d;
+            }
+
+            int const c_low = compare(r, m_minus);
+            int const c_high = compare(r + m_plus, s);
+            bool const tc1 = is_even ? c_low <= 0 : c_low < 0;
+            bool const tc2 = is_even ? c_high >= 0 : c_high > 0;
+
+            if(!tc1 && !tc2){
+                result.digits[result.size++] = static_cast<char>('0' + d);
+                continue;
+            }
+            if(tc1 && tc2){
+                int const c_half = compare(r + r, s);
+                d += c_half > 0 || (c_half == 0 && d % 2 == 1) ? 1 : 0;
+            }else if(tc2){
+                ++d;
+            }
+            result.digits[result.size++] = static_cast<char>('0' + d);
+            break;
+        }
+        return result;
+    }
+
+    inline constexpr size_t decimal_digits_of(int n)
+    {
+        size_t digits = 1;
+        for(n = n < 0 ? -n : n; n >= 10; n /= 10){
+            ++digits;
+        }
+        return digits;
+    }
+
+    // true for -0.0 as well, which compares equal to 0.0
+    template<class Float>
+    inline constexpr bool float_signbit(Float v)
+    {
+#if defined FROZEN_HAS_BUILTIN_SIGNBIT
+        return __builtin_signbit(v);
+#elif defined __cpp_lib_bit_cast
+        if constexpr(sizeof(Float) == sizeof(std::uint64_t)){
+            return std::bit_cast<std::uint64_t>(v) >> 63;
+        }else if constexpr(sizeof(Float) == sizeof(std::uint32_t)){
+            return std::bit_cast<std::uint32_t>(v) >> 31;
+        }else{
+            return v < 0;
+        }
+#else
+        return v < 0;
+#endif
+    }
+
+    template<class Float>
+    inline constexpr float_chars<Float> shortest_chars_constexpr(Float v)
+    {
+        float_chars<Float> out{{}, 0};
+
+        // the sign comes first so that -nan is spelled like std::to_chars does
+        if(float_signbit(v)){
+            out.push_back('-');
+            v = -v;
+        }
+        if(v != v){
+            out.push_back('n'); out.push_back('a'); out.push_back('n');
+            return out;
+        }
+        if(v > std::numeric_limits<Float>::max()){
+            out.push_back('i'); out.push_back('n'); out.push_back('f');
+            return out;
+        }
+        if(v == 0){
+            out.push_back('0');
+            return out;
+        }
+
+        float_decomposition<Float> const dec(v);
+        float_digits<Float> const d = shortest_digits(dec);
+        int const n = static_cast<int>(d.size);
+        int const exp10 = d.k - 1;
+
+        size_t const sci_size = d.size + (n > 1 ? 1 : 0) + 2 + (decimal_digits_of(exp10) < 2 ? 2 : decimal_digits_of(exp10));
+        size_t const fixed_size =
+            d.k >= n ? static_cast<size_t>(d.k) :
+            d.k > 0  ? d.size + 1 :
+                       d.size + 2 + static_cast<size_t>(-d.k);
+
+        if(fixed_size <= sci_size && d.k >= n){
+            // v is an integer here; print all of its digits exactly like
+            // printf("%.0f") instead of padding the shortest digits with zeros
+            typename float_traits<Float>::bignum_type i = dec.f;
+            if(dec.e >= 0){
+                i.shift_left(dec.e);
+            }else{
+                i.shift_right(-dec.e);
+            }
+            size_t const first = out.size;
+            for(size_t k = 0; k < static_cast<size_t>(d.k); ++k){
+                out.push_back(static_cast<char>('0' + i.div_small(10)));
+            }
+            for(size_t l = first, r = out.size - 1; l < r; ++l, --r){
+                char const c = out.data[l];
+                out.data[l] = out.data[r];
+                out.data[r] = c;
+            }
+        }else if(fixed_size <= sci_size){
+            if(d.k <= 0){
+                out.push_back('0');
+                out.push_back('.');
+                for(int i = 0; i < -d.k; ++i){
+                    out.push_back('0');
+                }
+            }
+            for(int i = 0; i < n; ++i){
+                if(i == d.k && d.k > 0){
+                    out.push_back('.');
+                }
+                out.push_back(d.digits[i]);
+            }
+        }else{
+            out.push_back(d.digits[0]);
+            if(n > 1){
+                out.push_back('.');
+                for(int i = 1; i < n; ++i){
+                    out.push_back(d.digits[i]);
+                }
+            }
+            out.push_back('e');
+            out.push_back(exp10 < 0 ? '-' : '+');
+            int const abs_exp = exp10 < 0 ? -exp10 : exp10;
+            size_t const width = decimal_digits_of(abs_exp) < 2 ? 2 : decimal_digits_of(abs_exp);
+            int scale = 1;
+            for(size_t i = 1; i < width; ++i){
+                scale *= 10;
+            }
+            for(; scale > 0; scale /= 10){
+                out.push_back(static_cast<char>('0' + abs_exp / scale % 10));
+            }
+        }
+        return out;
+    }
+
+#if defined __cpp_lib_to_chars && __cpp_lib_to_chars >= 201611L
+    template<class Float>
+    inline float_chars<Float> shortest_chars_runtime(Float v)
+    {
+        float_chars<Float> out{{}, 0};
+        std::to_chars_result const r = std::to_chars(out.data.data, out.data.data + out.data.size(), v);
+        out.size = static_cast<size_t>(r.ptr - out.data.data);
+        return out;
+    }
+#else
+    template<class Float>
+    inline float_chars<Float> shortest_chars_runtime(Float v)
+    {
+        return shortest_chars_constexpr(v);
+    }
+#endif
+
+    template<class Float>
+    inline constexpr float_chars<Float> shortest_chars(Float v)
+    {
+        return FROZEN_IS_CONSTANT_EVALUATED() ?
+                   shortest_chars_constexpr(v) :
+                   shortest_chars_runtime(v);
+    }
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_SHORTEST_HPP_INCLUDED
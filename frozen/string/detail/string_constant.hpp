@@ -0,0 +1,80 @@
+#if !defined FROZEN_STRING_DETAIL_STRING_CONSTANT_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_STRING_CONSTANT_HPP_INCLUDED
+
+#include <cstddef>
+
+#include "../../type_traits_aliases.hpp"
+#include "./macros.hpp"
+#include "./carray.hpp"
+#include "./fixed_literal.hpp"
+#include "./string_like.hpp"
+#include "../../meta/string/basic_string.hpp"
+
+namespace frozen {
+namespace detail {
+
+    using std::size_t;
+
+    // string_constant<T> gives the characters of a string carried by the
+    // type T, for the templates which take strings as template arguments:
+    //   char_type, size and chars(), which is NUL terminated
+    template<class T>
+    struct string_constant;
+
+    template<class Char, Char... Chars>
+    struct string_constant<meta::basic_string<Char, Chars...>>{
+        typedef Char char_type;
+        static constexpr size_t size = sizeof...(Chars);
+
+        static constexpr carray<Char, size + 1> chars() noexcept
+        {
+            return {{Chars..., static_cast<Char>('\0')}};
+        }
+    };
+
+#if defined FROZEN_HAS_AUTO_NTTP
+    // a constexpr string with static storage duration
+    template<auto const& S>
+    struct static_string{};
+
+    template<auto const& S>
+    struct string_constant<static_string<S>>{
+        typedef alias::remove_cv<alias::remove_pointer<decltype(detail::data_of(S))>> char_type;
+        static constexpr size_t size = detail::size_of(S);
+
+        static constexpr carray<char_type, size + 1> chars() noexcept
+        {
+            carray<char_type, size + 1> r{};
+            for(size_t i = 0; i < size; ++i){
+                r[i] = detail::data_of(S)[i];
+            }
+            return r;
+        }
+    };
+#endif
+
+#if defined FROZEN_HAS_CLASS_TYPE_NTTP
+    // a string literal
+    template<fixed_literal Lit>
+    struct literal_string{};
+
+    template<fixed_literal Lit>
+    struct string_constant<literal_string<Lit>>{
+        typedef typename decltype(Lit)::char_type char_type;
+        static constexpr size_t size = decltype(Lit)::size - 1;
+
+        static constexpr carray<char_type, size + 1> chars() noexcept
+        {
+            carray<char_type, size + 1> r{};
+            for(size_t i = 0; i < size; ++i){
+                r[i] = Lit[i];
+            }
+            return r;
+        }
+    };
+#endif
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_STRING_CONSTANT_HPP_INCLUDED
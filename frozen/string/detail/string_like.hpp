@@ -0,0 +1,95 @@
+#if !defined FROZEN_STRING_DETAIL_STRING_LIKE_HPP_INCLUDED
+#define      FROZEN_STRING_DETAIL_STRING_LIKE_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "./macros.hpp"
+#ifdef FROZEN_HAS_STRING_VIEW
+#   include <string_view>
+#endif
+
+#include "./strlen.hpp"
+#include "./compare.hpp"
+#include "./hash.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+// forward declaration
+template<class Char, size_t N>
+class basic_string;
+
+namespace detail {
+
+    // uniform access to the characters of the string types which can be
+    // used to query frozen containers
+
+    template<class Char, size_t N>
+    inline constexpr Char const* data_of(basic_string<Char, N> const& s) noexcept
+    {
+        return s.data();
+    }
+
+    template<class Char, size_t N>
+    inline constexpr size_t size_of(basic_string<Char, N> const& s) noexcept
+    {
+        return s.size();
+    }
+
+    template<class Char, size_t M>
+    inline constexpr Char const* data_of(Char const (&s)[M]) noexcept
+    {
+        return s;
+    }
+
+    template<class Char, size_t M>
+    inline constexpr size_t size_of(Char const (&s)[M])
+    {
+        return detail::strlen(s, M);
+    }
+
+    template<class Char>
+    inline Char const* data_of(std::basic_string<Char> const& s) noexcept
+    {
+        return s.data();
+    }
+
+    template<class Char>
+    inline size_t size_of(std::basic_string<Char> const& s) noexcept
+    {
+        return s.size();
+    }
+
+#ifdef FROZEN_HAS_STRING_VIEW
+    template<class Char>
+    inline constexpr Char const* data_of(std::basic_string_view<Char> s) noexcept
+    {
+        return s.data();
+    }
+
+    template<class Char>
+    inline constexpr size_t size_of(std::basic_string_view<Char> s) noexcept
+    {
+        return s.size();
+    }
+#endif
+
+    template<class String>
+    inline constexpr std::uint64_t hash_of(String const& s)
+    {
+        return detail::fnv1a(detail::data_of(s), detail::size_of(s));
+    }
+
+    template<class L, class R>
+    inline constexpr bool string_equal(L const& lhs, R const& rhs)
+    {
+        return detail::size_of(lhs) == detail::size_of(rhs) &&
+               detail::equal(detail::data_of(lhs), detail::data_of(rhs), detail::size_of(lhs));
+    }
+
+} // namespace detail
+} // namespace frozen
+
+#endif    // FROZEN_STRING_DETAIL_STRING_LIKE_HPP_INCLUDED
@@ -6,19 +6,56 @@
 #include <stdexcept>
 #include <cstddef>
 
+#include "./macros.hpp"
+
 namespace frozen {
 namespace detail {
 
     using std::size_t;
 
     namespace impl {
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+        // loops instead of a call per character: the compiler evaluates them
+        // in linear time and memory, whatever the length of the string
+
+        template<class String>
+        inline constexpr
+        size_t strnlen_impl(String const& s, size_t first, size_t last)
+        {
+            for(; first < last; ++first){
+                if(s[first] == '\0'){
+                    break;
+                }
+            }
+            return first;
+        }
+#else
         template<class String>
         inline constexpr
-        size_t strlen_impl(String const& s, size_t idx_max, size_t idx)
+        size_t strnlen_impl(String const& s, size_t first, size_t last);
+
+        template<class String>
+        inline constexpr
+        size_t strnlen_right(String const& s, size_t found, size_t mid, size_t last)
         {
-            return idx >= idx_max ? throw std::length_error("strlen out of length limit") :
-                   s[idx] == '\0' ? 0 :
-                                    1 + strlen_impl(s, idx_max, idx+1);
+            return found != mid ? found : strnlen_impl(s, mid, last);
+        }
+
+        // bisect [first, last) so that the recursion depth is O(log N)
+        template<class String>
+        inline constexpr
+        size_t strnlen_impl(String const& s, size_t first, size_t last)
+        {
+            return last - first == 0 ? first :
+                   last - first == 1 ? (s[first] == '\0' ? first : last) :
+                   strnlen_right(s, strnlen_impl(s, first, first + (last-first)/2), first + (last-first)/2, last);
+        }
+#endif
+
+        inline constexpr
+        size_t strlen_check(size_t n, size_t idx_max)
+        {
+            return n == idx_max ? throw std::length_error("strlen out of length limit") : n;
         }
     } // namespace impl
 
@@ -27,7 +64,15 @@ namespace detail {
     inline constexpr
     size_t strlen(String const& s, size_t idx_max = std::numeric_limits<size_t>::max())
     {
-        return impl::strlen_impl(s, idx_max, 0);
+        return impl::strlen_check(impl::strnlen_impl(s, 0, idx_max), idx_max);
+    }
+
+    // @brief: same as strlen() but returns max_len when s has no '\0' in [0, max_len).
+    template<class String>
+    inline constexpr
+    size_t strnlen(String const& s, size_t max_len)
+    {
+        return impl::strnlen_impl(s, 0, max_len);
     }
 
 } // namespace detail
@@ -1,6 +1,9 @@
 #if !defined FROZEN_STRING_DETAIL_UTIL_HPP_INCLUDED
 #define      FROZEN_STRING_DETAIL_UTIL_HPP_INCLUDED
 
+#include <cstddef>
+#include <cstdint>
+
 #include "../../type_traits_aliases.hpp"
 
 namespace frozen {
@@ -42,6 +45,13 @@ template<class CharT>
 struct is_wide_char<CharT, true> : std::integral_constant<bool, true>
 {};
 
+// the smallest unsigned integer which can hold [0, N], for tables of indices
+template<std::size_t N>
+using uint_least_for =
+    alias::conditional<(N < 0xff), std::uint8_t,
+    alias::conditional<(N < 0xffff), std::uint16_t,
+                                    std::uint32_t>>;
+
 template<class T, class U>
 inline constexpr
 T pow(T base, U exp) noexcept
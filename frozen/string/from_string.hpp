@@ -0,0 +1,66 @@
+#if !defined FROZEN_STRING_FROM_STRING_HPP_INCLUDED
+#define      FROZEN_STRING_FROM_STRING_HPP_INCLUDED
+
+#include <cstddef>
+
+#include "../type_traits_aliases.hpp"
+#include "./detail/macros.hpp"
+#include "./detail/strlen.hpp"
+#include "./detail/parse.hpp"
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+#   include "./detail/parse_float.hpp"
+#endif
+#include "./basic_string.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+// @brief: parse an integer at the beginning of s like std::from_chars():
+//         an optional '-' (signed types only) and digits of base in [2, 36].
+//
+//   frozen::to_integer<int>("-42").value;         // -42
+//   frozen::to_integer<unsigned>("ff", 16).value; // 255
+template<class T, class Char, size_t N,
+         class = alias::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>>
+inline constexpr
+parse_result<T> to_integer(basic_string<Char, N> const& s, int base = 10)
+{
+    return detail::to_integer<T>(s.data(), s.size(), base);
+}
+
+template<class T, class Char, size_t M,
+         class = alias::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>>
+inline constexpr
+parse_result<T> to_integer(Char const (&s)[M], int base = 10)
+{
+    return detail::to_integer<T>(s, detail::strlen(s, M), base);
+}
+
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+// @brief: parse a floating point number at the beginning of s like
+//         std::from_chars() in the general format, rounded to nearest:
+//         an optional '-', digits with an optional '.' and exponent, "inf",
+//         "infinity" or "nan".
+//
+//   frozen::to_floating<double>("1.5e3").value; // 1500.0
+template<class T, class Char, size_t N,
+         class = alias::enable_if<std::is_floating_point<T>::value>>
+inline constexpr
+parse_result<T> to_floating(basic_string<Char, N> const& s)
+{
+    return detail::to_floating<T>(s.data(), s.size());
+}
+
+template<class T, class Char, size_t M,
+         class = alias::enable_if<std::is_floating_point<T>::value>>
+inline constexpr
+parse_result<T> to_floating(Char const (&s)[M])
+{
+    return detail::to_floating<T>(s, detail::strlen(s, M));
+}
+#endif
+
+} // namespace frozen
+
+#endif    // FROZEN_STRING_FROM_STRING_HPP_INCLUDED
@@ -0,0 +1,54 @@
+#if !defined FROZEN_STRING_HASH_HPP_INCLUDED
+#define      FROZEN_STRING_HASH_HPP_INCLUDED
+
+#include <cstddef>
+#include <functional>
+
+#include "./basic_string.hpp"
+#include "./detail/string_like.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+// transparent hasher: a frozen string and the same characters in any other
+// string type give the same hash, so unordered containers keyed by frozen
+// strings can be probed without constructing a key
+struct string_hash{
+    typedef void is_transparent;
+
+    template<class String>
+    constexpr size_t operator()(String const& s) const
+    {
+        return static_cast<size_t>(detail::hash_of(s));
+    }
+};
+
+struct string_equal{
+    typedef void is_transparent;
+
+    template<class L, class R>
+    constexpr bool operator()(L const& lhs, R const& rhs) const
+    {
+        return detail::string_equal(lhs, rhs);
+    }
+};
+
+} // namespace frozen
+
+namespace std {
+
+template<class Char, size_t N>
+struct hash<frozen::basic_string<Char, N>>{
+    typedef frozen::basic_string<Char, N> argument_type;
+    typedef size_t result_type;
+
+    size_t operator()(frozen::basic_string<Char, N> const& s) const
+    {
+        return static_cast<size_t>(s.hash());
+    }
+};
+
+} // namespace std
+
+#endif    // FROZEN_STRING_HASH_HPP_INCLUDED
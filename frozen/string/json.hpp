@@ -0,0 +1,409 @@
+#if !defined FROZEN_STRING_JSON_HPP_INCLUDED
+#define      FROZEN_STRING_JSON_HPP_INCLUDED
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../type_traits_aliases.hpp"
+#include "./detail/macros.hpp"
+#include "./detail/indices.hpp"
+#include "./detail/array_wrapper.hpp"
+#include "./detail/strlen.hpp"
+#include "./detail/util.hpp"
+#include "./basic_string.hpp"
+#include "./to_string.hpp"
+#include "./concat.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+namespace json {
+
+// @brief: serialized JSON.  It is a basic_string, which object() and array()
+//         nest as it is instead of as a JSON string.
+template<class Char, size_t N>
+class value : public basic_string<Char, N>{
+public:
+    constexpr explicit value(basic_string<Char, N> const& s)
+        : basic_string<Char, N>(s)
+    {}
+};
+
+} // namespace json
+
+namespace detail {
+
+    // "key":value, which only object() takes
+    template<class String>
+    struct json_member{
+        String str;
+    };
+
+    // the character type of the first string among the arguments, char if none
+    template<class T>
+    struct json_char_of{
+        typedef alias::conditional<detail::check_char<T>::value, T, void> type;
+    };
+
+    template<class Char, size_t N>
+    struct json_char_of<basic_string<Char, N>>{
+        typedef Char type;
+    };
+
+    template<class Char, size_t N>
+    struct json_char_of<json::value<Char, N>>{
+        typedef Char type;
+    };
+
+    template<class Char, size_t N>
+    struct json_char_of<Char[N]>{
+        typedef Char type;
+    };
+
+    template<class String>
+    struct json_char_of<json_member<String>>{
+        typedef typename String::value_type type;
+    };
+
+    template<class... Args>
+    struct json_char{
+        typedef char type;
+    };
+
+    template<class T, class... Args>
+    struct json_char<T, Args...>
+        : alias::conditional<
+              std::is_void<typename json_char_of<T>::type>::value,
+              json_char<Args...>,
+              json_char_of<T>
+          >
+    {};
+
+    template<class T>
+    struct is_json_string
+        : std::integral_constant<bool, !std::is_void<typename json_char_of<T>::type>::value>
+    {};
+
+    template<class Char, size_t N>
+    struct is_json_string<json::value<Char, N>> : std::false_type
+    {};
+
+    template<class String>
+    struct is_json_string<json_member<String>> : std::false_type
+    {};
+
+    // the length of c in a JSON string: \" \\ \b \f \n \r \t, and \u00XX for
+    // the other control characters
+    template<class Char>
+    inline constexpr
+    size_t json_escaped_length(Char c)
+    {
+        return c == '"' || c == '\\' || c == '\b' || c == '\f' || c == '\n' || c == '\r' || c == '\t' ? 2 :
+               static_cast<unsigned long long>(c) < 0x20 ? 6 : 1;
+    }
+
+    template<class Char>
+    inline constexpr
+    Char json_escaped_char_at(Char c, size_t idx)
+    {
+        return static_cast<Char>(
+                   json_escaped_length(c) == 1 ? c :
+                   idx == 0 ? '\\' :
+                   json_escaped_length(c) == 2 ?
+                       ( c == '\b' ? 'b' : c == '\f' ? 'f' : c == '\n' ? 'n' : c == '\r' ? 'r' : c == '\t' ? 't' : c ) :
+                   idx < 4 ? "u00"[idx - 1] :
+                   "0123456789abcdef"[idx == 4 ? static_cast<size_t>(c) >> 4 : static_cast<size_t>(c) & 0xf]
+               );
+    }
+
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+    template<class Char, size_t N>
+    inline constexpr
+    basic_string<Char, N> json_quote(Char const* s, size_t n, detail::copy_loop<N>)
+    {
+        array_wrapper<Char, N> r{};
+        size_t out = 0;
+        r.data[out++] = static_cast<Char>('"');
+        for(size_t i = 0; i < n; ++i){
+            for(size_t k = 0; k < json_escaped_length(s[i]); ++k){
+                r.data[out++] = json_escaped_char_at(s[i], k);
+            }
+        }
+        r.data[out++] = static_cast<Char>('"');
+        return r;
+    }
+#else
+    template<class Char>
+    inline constexpr
+    size_t json_escaped_length(Char const* s, size_t first, size_t last)
+    {
+        return last - first == 0 ? 0 :
+               last - first == 1 ? json_escaped_length(s[first]) :
+               json_escaped_length(s, first, first + (last-first)/2) + json_escaped_length(s, first + (last-first)/2, last);
+    }
+
+    template<class Char>
+    inline constexpr
+    Char json_escaped_at(Char const* s, size_t first, size_t last, size_t idx);
+
+    template<class Char>
+    inline constexpr
+    Char json_escaped_at_split(Char const* s, size_t first, size_t mid, size_t last, size_t left, size_t idx)
+    {
+        return idx < left ? json_escaped_at(s, first, mid, idx) : json_escaped_at(s, mid, last, idx - left);
+    }
+
+    // the character at idx of the escaped [first, last); bisect so that the
+    // recursion depth is O(log N)
+    template<class Char>
+    inline constexpr
+    Char json_escaped_at(Char const* s, size_t first, size_t last, size_t idx)
+    {
+        return last - first == 1 ? json_escaped_char_at(s[first], idx) :
+               json_escaped_at_split(s, first, first + (last-first)/2, last,
+                                     json_escaped_length(s, first, first + (last-first)/2), idx);
+    }
+
+    template<class Char>
+    inline constexpr
+    Char json_quoted_at(Char const* s, size_t n, size_t escaped, size_t idx)
+    {
+        return idx == 0 || idx == escaped + 1 ? static_cast<Char>('"') :
+               idx <= escaped ? json_escaped_at(s, 0, n, idx - 1) :
+               static_cast<Char>('\0');
+    }
+
+    template<class Char, size_t N, size_t... Indices>
+    inline constexpr
+    basic_string<Char, N> json_quote_impl(Char const* s, size_t n, size_t escaped, detail::indices<Indices...>)
+    {
+        return detail::array_wrapper<Char, N>{{ json_quoted_at(s, n, escaped, Indices)... }};
+    }
+
+    template<class Char, size_t N, size_t... Indices>
+    inline constexpr
+    basic_string<Char, N> json_quote(Char const* s, size_t n, detail::indices<Indices...> i)
+    {
+        return json_quote_impl<Char, N>(s, n, json_escaped_length(s, 0, n), i);
+    }
+#endif
+
+    // every value as its JSON text; a string is at most 6 times longer escaped
+    template<class Char, size_t N>
+    inline constexpr
+    basic_string<Char, N> const& json_serialize(json::value<Char, N> const& v)
+    {
+        return v;
+    }
+
+    template<class Char, size_t N, size_t M = 6 * basic_string<Char, N>::len + 2>
+    inline constexpr
+    basic_string<Char, M> json_serialize(basic_string<Char, N> const& s)
+    {
+        return json_quote<Char, M>(s.data(), s.size(), detail::copy_indices<M>());
+    }
+
+    template<class Char, size_t N, size_t M = 6 * (N - 1) + 2>
+    inline constexpr
+    basic_string<Char, M> json_serialize(Char const (&s)[N])
+    {
+        return json_quote<Char, M>(s, detail::strlen(s, N), detail::copy_indices<M>());
+    }
+
+    template<class Char>
+    inline constexpr
+    basic_string<Char, 8> json_serialize_char(detail::array_wrapper<Char, 1> const& c)
+    {
+        return json_quote<Char, 8>(c.data, 1, detail::copy_indices<8>());
+    }
+
+    template<class Char, class C, class = alias::enable_if<detail::check_char<C>::value>>
+    inline constexpr
+    basic_string<Char, 8> json_serialize(C c)
+    {
+        return json_serialize_char(detail::array_wrapper<Char, 1>{{static_cast<Char>(c)}});
+    }
+
+    template<class Char, class B, class = alias::enable_if<std::is_same<B, bool>::value>>
+    inline constexpr
+    basic_string<Char, 5> json_serialize(B b)
+    {
+        return b ? detail::array_wrapper<Char, 5>{{'t', 'r', 'u', 'e'}} :
+                   detail::array_wrapper<Char, 5>{{'f', 'a', 'l', 's', 'e'}};
+    }
+
+    template<class Char, class T,
+             class = alias::enable_if<
+                         std::is_integral<T>::value && !detail::check_char<T>::value && !std::is_same<T, bool>::value
+                     >>
+    inline constexpr
+    auto json_serialize(T t)
+        -> decltype(to_basic_string<Char>(t))
+    {
+        return to_basic_string<Char>(t);
+    }
+
+    template<class Char, class T, class = alias::enable_if<std::is_floating_point<T>::value>, class = void>
+    inline constexpr
+    auto json_serialize(T t)
+        -> decltype(to_basic_string<Char>(t))
+    {
+        // NaN and infinities are not JSON numbers
+        return t - t == 0 ? to_basic_string<Char>(t) : throw std::domain_error("json: not a finite number");
+    }
+
+    template<class Char, class T>
+    struct json_serialized{
+        typedef alias::remove_cv<alias::remove_reference<decltype(json_serialize<Char>(std::declval<T const&>()))>> type;
+    };
+
+    template<class Char, class... Pieces>
+    struct json_joined_capacity;
+
+    template<class Char>
+    struct json_joined_capacity<Char> : std::integral_constant<size_t, 0>
+    {};
+
+    template<class Char, class String, class... Pieces>
+    struct json_joined_capacity<Char, String, Pieces...>
+        : std::integral_constant<size_t, String::len + (sizeof...(Pieces) ? 1 : 0) + json_joined_capacity<Char, Pieces...>::value>
+    {};
+
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+    template<class Char, size_t N, class... Pieces>
+    inline constexpr
+    basic_string<Char, N> json_join(detail::copy_loop<N>, Char open, Char close, Pieces const&... pieces)
+    {
+        concat_piece<Char> const all[] = {pieces..., {nullptr, 0, static_cast<Char>('\0'), true}};
+        detail::array_wrapper<Char, N> r{};
+        size_t out = 0;
+        r.data[out++] = open;
+        for(size_t p = 0; p < sizeof...(Pieces); ++p){
+            if(p != 0){
+                r.data[out++] = static_cast<Char>(',');
+            }
+            for(size_t i = 0; i < all[p].size; ++i){
+                r.data[out++] = all[p][i];
+            }
+        }
+        r.data[out++] = close;
+        return r;
+    }
+#else
+    template<class Char>
+    inline constexpr
+    size_t json_joined_size()
+    {
+        return 0;
+    }
+
+    template<class Char, class... Pieces>
+    inline constexpr
+    size_t json_joined_size(concat_piece<Char> const& head, Pieces const&... tail)
+    {
+        return head.size + (sizeof...(Pieces) ? 1 : 0) + json_joined_size<Char>(tail...);
+    }
+
+    template<class Char>
+    inline constexpr
+    Char json_joined_at(size_t)
+    {
+        return static_cast<Char>('\0');
+    }
+
+    // the pieces separated by ','
+    template<class Char, class... Pieces>
+    inline constexpr
+    Char json_joined_at(size_t idx, concat_piece<Char> const& head, Pieces const&... tail)
+    {
+        return idx < head.size ? head[idx] :
+               idx == head.size ? static_cast<Char>(sizeof...(Pieces) ? ',' : '\0') :
+               json_joined_at<Char>(idx - head.size - 1, tail...);
+    }
+
+    template<class Char, size_t N, size_t... Indices, class... Pieces>
+    inline constexpr
+    basic_string<Char, N> json_join_impl(detail::indices<Indices...>, Char open, Char close, size_t body, Pieces const&... pieces)
+    {
+        return detail::array_wrapper<Char, N>{{
+                   ( Indices == 0 ? open :
+                     Indices <= body ? json_joined_at<Char>(Indices - 1, pieces...) :
+                     Indices == body + 1 ? close :
+                     static_cast<Char>('\0') )...
+               }};
+    }
+
+    template<class Char, size_t N, size_t... Indices, class... Pieces>
+    inline constexpr
+    basic_string<Char, N> json_join(detail::indices<Indices...> i, Char open, Char close, Pieces const&... pieces)
+    {
+        return json_join_impl<Char, N>(i, open, close, json_joined_size<Char>(pieces...), pieces...);
+    }
+#endif
+
+} // namespace detail
+
+namespace json {
+
+// @brief: "key":v for object().  The key is a string, v is a string, a
+//         character, a number, a bool or the result of object() or array().
+template<class K, class V, class Char = typename detail::json_char<K, V>::type>
+inline constexpr
+auto member(K const& key, V const& v)
+    -> detail::json_member<decltype(frozen::concat(detail::json_serialize<Char>(key), static_cast<Char>(':'), detail::json_serialize<Char>(v)))>
+{
+    FROZEN_STATIC_ASSERT(detail::is_json_string<K>::value);
+    return {frozen::concat(detail::json_serialize<Char>(key), static_cast<Char>(':'), detail::json_serialize<Char>(v))};
+}
+
+// @brief: {"key":v,...} of Char characters, from the results of member().
+template<class Char, class... Members,
+         size_t N = detail::json_joined_capacity<Char, decltype(std::declval<Members>().str)...>::value + 3>
+inline constexpr
+value<Char, N> basic_object(Members const&... members)
+{
+    FROZEN_STATIC_ASSERT(std::is_same<Char, typename detail::json_char<Members...>::type>::value || sizeof...(Members) == 0);
+    return value<Char, N>(detail::json_join<Char, N>(detail::copy_indices<N>(), static_cast<Char>('{'), static_cast<Char>('}'),
+                                                     detail::as_piece<Char>(members.str)...));
+}
+
+// @brief: [v,...] of Char characters; v is what member() takes as a value.
+template<class Char, class... Values,
+         size_t N = detail::json_joined_capacity<Char, typename detail::json_serialized<Char, Values>::type...>::value + 3>
+inline constexpr
+value<Char, N> basic_array(Values const&... values)
+{
+    return value<Char, N>(detail::json_join<Char, N>(detail::copy_indices<N>(), static_cast<Char>('['), static_cast<Char>(']'),
+                                                     detail::as_piece<Char>(detail::json_serialize<Char>(values))...));
+}
+
+// @brief: basic_object() and basic_array() of the character type of the
+//         first string among the arguments, or char.
+//
+//   constexpr auto health = FROZEN_SHRINK(frozen::json::object(
+//       frozen::json::member("status", "ok"),
+//       frozen::json::member("checks", frozen::json::array(1, 2.5, true))));
+//   // {"status":"ok","checks":[1,2.5,true]}, a frozen::string<38>
+template<class... Members, class Char = typename detail::json_char<Members...>::type>
+inline constexpr
+auto object(Members const&... members)
+    -> decltype(json::basic_object<Char>(members...))
+{
+    return json::basic_object<Char>(members...);
+}
+
+template<class... Values, class Char = typename detail::json_char<Values...>::type>
+inline constexpr
+auto array(Values const&... values)
+    -> decltype(json::basic_array<Char>(values...))
+{
+    return json::basic_array<Char>(values...);
+}
+
+} // namespace json
+} // namespace frozen
+
+#endif    // FROZEN_STRING_JSON_HPP_INCLUDED
@@ -7,6 +7,7 @@
 #include "./detail/digits.hpp"
 #include "./detail/strlen.hpp"
 #include "./detail/macros.hpp"
+#include "./detail/fixed_literal.hpp"
 #include "./basic_string.hpp"
 
 
@@ -23,6 +24,15 @@ namespace detail {
 
         constexpr operator_literal_fstr_impl(size_t s) : size(s) {}
 
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+        template<class Char, size_t N>
+        constexpr
+        basic_string<Char, N>
+        operator()(Char const* str, copy_loop<N>) const
+        {
+            return detail::make_array_wrapper<Char, N>(str, size);
+        }
+#else
         template<class Char, size_t... Indices>
         constexpr
         basic_string<Char, sizeof...(Indices)>
@@ -30,6 +40,7 @@ namespace detail {
         {
             return {{{ Indices < size ? str[Indices] : static_cast<Char>('\0')... }}};
         }
+#endif
     };
 
 } // namespace detail
@@ -42,34 +53,76 @@ operator "" _fstr()
     return {{{Chars..., '\0'}}};
 }
 
+#if defined FROZEN_HAS_CLASS_TYPE_NTTP
+
+// the result has exactly the capacity of the literal
+template<detail::fixed_literal Lit>
+inline constexpr
+basic_string<typename decltype(Lit)::char_type, decltype(Lit)::size>
+operator"" _fstr()
+{
+    return detail::operator_literal_fstr_impl{decltype(Lit)::size}(Lit.data, detail::copy_indices<decltype(Lit)::size>());
+}
+
+#elif defined FROZEN_HAS_GNU_STRING_LITERAL_OPERATOR_TEMPLATE
+
+#if defined __clang__
+#    pragma clang diagnostic push
+#    pragma clang diagnostic ignored "-Wgnu-string-literal-operator-template"
+#else
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+// the result has exactly the capacity of the literal
+template<class Char, Char... Chars>
+inline constexpr
+basic_string<Char, sizeof...(Chars)+1>
+operator"" _fstr()
+{
+    return {{{Chars..., static_cast<Char>('\0')}}};
+}
+
+#if defined __clang__
+#    pragma clang diagnostic pop
+#else
+#    pragma GCC diagnostic pop
+#endif
+
+#else
+
+// string literals cannot be template arguments; the capacity of the result
+// is FROZEN_STRING_LITERALS_MAX_LENGTH
 inline constexpr
 basic_string<char, FROZEN_STRING_LITERALS_MAX_LENGTH>
 operator"" _fstr(char const* str, size_t const size)
 {
-    return detail::operator_literal_fstr_impl{size}(str, detail::make_indices<0, FROZEN_STRING_LITERALS_MAX_LENGTH>());
+    return detail::operator_literal_fstr_impl{size}(str, detail::copy_indices<FROZEN_STRING_LITERALS_MAX_LENGTH>());
 }
 
 inline constexpr
 basic_string<wchar_t, FROZEN_STRING_LITERALS_MAX_LENGTH>
 operator"" _fstr(wchar_t const* str, size_t const size)
 {
-    return detail::operator_literal_fstr_impl{size}(str, detail::make_indices<0, FROZEN_STRING_LITERALS_MAX_LENGTH>());
+    return detail::operator_literal_fstr_impl{size}(str, detail::copy_indices<FROZEN_STRING_LITERALS_MAX_LENGTH>());
 }
 
 inline constexpr
 basic_string<char16_t, FROZEN_STRING_LITERALS_MAX_LENGTH>
 operator"" _fstr(char16_t const* str, size_t const size)
 {
-    return detail::operator_literal_fstr_impl{size}(str, detail::make_indices<0, FROZEN_STRING_LITERALS_MAX_LENGTH>());
+    return detail::operator_literal_fstr_impl{size}(str, detail::copy_indices<FROZEN_STRING_LITERALS_MAX_LENGTH>());
 }
 
 inline constexpr
 basic_string<char32_t, FROZEN_STRING_LITERALS_MAX_LENGTH>
 operator"" _fstr(char32_t const* str, size_t const size)
 {
-    return detail::operator_literal_fstr_impl{size}(str, detail::make_indices<0, FROZEN_STRING_LITERALS_MAX_LENGTH>());
+    return detail::operator_literal_fstr_impl{size}(str, detail::copy_indices<FROZEN_STRING_LITERALS_MAX_LENGTH>());
 }
 
+#endif
+
 inline constexpr
 basic_string<char, 2>
 operator"" _fstr(char c)
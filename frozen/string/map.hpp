@@ -0,0 +1,112 @@
+#if !defined FROZEN_STRING_MAP_HPP_INCLUDED
+#define      FROZEN_STRING_MAP_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "./basic_string.hpp"
+#include "./detail/indices.hpp"
+#include "./detail/string_like.hpp"
+#include "./detail/pmh.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+// Immutable associative container built at compile-time.
+//
+//   constexpr frozen::map<frozen::string<8>, int, 2> methods = {{"GET", 1}, {"POST", 2}};
+//   methods.at("POST"); // 2
+//
+// Key is a basic_string.  A perfect hash over the keys is chosen while the
+// map is constructed, so lookup costs one hash and one key comparison.
+// find()/at()/count() accept any string with the same character type.
+template<class Key, class Value, size_t N>
+class map{
+    FROZEN_STATIC_ASSERT(N > 0);
+
+public:
+    typedef Key key_type;
+    typedef Value mapped_type;
+    typedef std::pair<Key, Value> value_type;
+    typedef value_type const& const_reference;
+    typedef value_type const* const_iterator;
+    typedef size_t size_type;
+
+    constexpr map(std::initializer_list<value_type> items)
+        : map(items.size() == N ? items.begin() : throw std::invalid_argument("frozen::map: wrong number of items"),
+              detail::make_indices<0, N>())
+    {}
+
+    constexpr const_iterator begin() const noexcept
+    {
+        return items_;
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+        return items_ + N;
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return N;
+    }
+
+    constexpr bool empty() const noexcept
+    {
+        return false;
+    }
+
+    template<class String>
+    constexpr const_iterator find(String const& key) const
+    {
+        return find_at(table_.lookup(detail::hash_of(key)), key);
+    }
+
+    template<class String>
+    constexpr size_type count(String const& key) const
+    {
+        return find(key) != end();
+    }
+
+    template<class String>
+    constexpr bool contains(String const& key) const
+    {
+        return find(key) != end();
+    }
+
+    template<class String>
+    constexpr Value const& at(String const& key) const
+    {
+        return at_impl(find(key));
+    }
+
+private:
+    template<size_t... Indices>
+    constexpr map(value_type const* items, detail::indices<Indices...>)
+        : items_{items[Indices]...}
+        , table_(detail::carray<std::uint64_t, N>{{items[Indices].first.hash()...}})
+    {}
+
+    constexpr Value const& at_impl(const_iterator it) const
+    {
+        return it != end() ? it->second : throw std::out_of_range("frozen::map::at");
+    }
+
+    template<class String>
+    constexpr const_iterator find_at(size_t idx, String const& key) const
+    {
+        return idx != N && detail::string_equal(items_[idx].first, key) ? items_ + idx : end();
+    }
+
+    value_type const items_[N];
+    detail::pmh_table<N> const table_;
+};
+
+} // namespace frozen
+
+#endif    // FROZEN_STRING_MAP_HPP_INCLUDED
@@ -0,0 +1,345 @@
+#if !defined FROZEN_STRING_MULTI_MATCHER_HPP_INCLUDED
+#define      FROZEN_STRING_MULTI_MATCHER_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+
+#include "../type_traits_aliases.hpp"
+#include "./detail/macros.hpp"
+#include "./detail/carray.hpp"
+#include "./detail/search.hpp"
+#include "./detail/string_like.hpp"
+#include "./detail/util.hpp"
+#include "./basic_string.hpp"
+#include "../meta/string/basic_string.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+namespace detail {
+
+    // the characters of every pattern source, and how many of them there can be
+    template<class T>
+    struct pattern_source;
+
+    template<class Char, size_t N>
+    struct pattern_source<basic_string<Char, N>>{
+        typedef Char char_type;
+        static constexpr size_t capacity = basic_string<Char, N>::len;
+
+        static constexpr basic_string<Char, N> const& get(basic_string<Char, N> const& s) noexcept
+        {
+            return s;
+        }
+    };
+
+    template<class Char, size_t M>
+    struct pattern_source<Char[M]>{
+        typedef Char char_type;
+        static constexpr size_t capacity = M - 1;
+
+        static constexpr auto get(Char const (&s)[M]) noexcept
+            -> Char const (&)[M]
+        {
+            return s;
+        }
+    };
+
+    template<class Char, Char... Chars>
+    struct pattern_source<meta::basic_string<Char, Chars...>>{
+        typedef Char char_type;
+        static constexpr size_t capacity = sizeof...(Chars);
+
+        static constexpr basic_string<Char, sizeof...(Chars) + 1> get(meta::basic_string<Char, Chars...>) noexcept
+        {
+            return {{{Chars..., static_cast<Char>('\0')}}};
+        }
+    };
+
+    template<class... Patterns>
+    struct pattern_capacity;
+
+    template<>
+    struct pattern_capacity<> : std::integral_constant<size_t, 0>
+    {};
+
+    template<class Head, class... Tail>
+    struct pattern_capacity<Head, Tail...>
+        : std::integral_constant<size_t, pattern_source<Head>::capacity + pattern_capacity<Tail...>::value>
+    {};
+
+    template<class Char>
+    struct pattern_view{
+        Char const* data;
+        size_t size;
+    };
+
+    template<class Char, class... Patterns>
+    inline constexpr carray<pattern_view<Char>, sizeof...(Patterns)> pattern_views(Patterns const&... patterns)
+    {
+        return {{ {detail::data_of(patterns), detail::size_of(patterns)}... }};
+    }
+
+} // namespace detail
+
+// @brief: Aho-Corasick automaton of a fixed set of patterns, built at
+//         compile-time.  A haystack is scanned in a single pass with one
+//         table read per character, whatever the number of patterns.
+//
+//         The transitions are a dense States x Columns table, where the
+//         columns are the distinct characters of the patterns plus one for
+//         every other character.  Use make_multi_matcher() to build one.
+template<class Char, size_t Count, size_t States, size_t Columns>
+class multi_matcher{
+public:
+    typedef size_t size_type;
+    typedef detail::uint_least_for<(States > Columns ? States : Columns)> index_type;
+
+    static constexpr size_type npos = detail::npos;
+
+    // pattern is the index in the arguments of make_multi_matcher() and
+    // position where it begins in the haystack; both are npos if not found
+    struct match{
+        size_type pattern;
+        size_type position;
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return pattern != npos;
+        }
+    };
+
+    constexpr explicit multi_matcher(detail::carray<detail::pattern_view<Char>, Count> const& views)
+        : letters_{}, letter_count_(0), byte_columns_{}, delta_{}, fail_{}, output_{}, dict_{}, lengths_{}
+    {
+        build_alphabet(views);
+        build_trie(views);
+        build_links();
+    }
+
+    // @brief: the match which ends first at or after pos (the longest one if several end there)
+    template<class String>
+    constexpr auto find(String const& s, size_type pos = 0) const
+        -> decltype(static_cast<void>(detail::size_of(s)), match())
+    {
+        return find(detail::data_of(s), detail::size_of(s), pos);
+    }
+
+    constexpr match find(Char const* s, size_type n, size_type pos) const
+    {
+        size_type state = 0;
+        for(size_type i = pos; i < n; ++i){
+            state = step(state, s[i]);
+            if(output_[state] != Count){
+                return {output_[state], i + 1 - lengths_[output_[state]]};
+            }
+            if(dict_[state] != 0){
+                return {output_[dict_[state]], i + 1 - lengths_[output_[dict_[state]]]};
+            }
+        }
+        return {npos, npos};
+    }
+
+    template<class String>
+    constexpr auto contains_any(String const& s) const
+        -> decltype(detail::size_of(s) != 0)
+    {
+        return static_cast<bool>(find(s));
+    }
+
+    // @brief: call f(match) for every occurrence of every pattern, in the order they end
+    template<class String, class F>
+    constexpr void for_each(String const& s, F&& f) const
+    {
+        Char const* const data = detail::data_of(s);
+        size_type const n = detail::size_of(s);
+        size_type state = 0;
+        for(size_type i = 0; i < n; ++i){
+            state = step(state, data[i]);
+            for(size_type out = output_[state] != Count ? state : dict_[state]; out != 0; out = dict_[out]){
+                f(match{output_[out], i + 1 - lengths_[output_[out]]});
+            }
+        }
+    }
+
+    template<class String>
+    constexpr size_type count(String const& s) const
+    {
+        size_type n = 0;
+        for_each(s, counter{n});
+        return n;
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return Count;
+    }
+
+    constexpr size_type column(Char c) const noexcept
+    {
+        return sizeof(Char) == 1 ? byte_columns_[static_cast<unsigned char>(c)] : search_column(c);
+    }
+
+private:
+    struct counter{
+        size_type& n;
+
+        constexpr void operator()(match) const
+        {
+            ++n;
+        }
+    };
+
+    constexpr size_type step(size_type state, Char c) const noexcept
+    {
+        return delta_[state * Columns + column(c)];
+    }
+
+    // letters_ is sorted; unknown characters are in the last column
+    constexpr size_type search_column(Char c) const noexcept
+    {
+        size_type first = 0, last = letter_count_;
+        while(first < last){
+            size_type const mid = first + (last - first) / 2;
+            if(letters_[mid] < c){
+                first = mid + 1;
+            }else{
+                last = mid;
+            }
+        }
+        return first < letter_count_ && letters_[first] == c ? first : Columns - 1;
+    }
+
+    constexpr void build_alphabet(detail::carray<detail::pattern_view<Char>, Count> const& views)
+    {
+        for(size_type p = 0; p < Count; ++p){
+            if(views[p].size == 0){
+                throw std::invalid_argument("empty pattern in multi_matcher");
+            }
+            for(size_type i = 0; i < views[p].size; ++i){
+                Char const c = views[p].data[i];
+                size_type j = letter_count_;
+                for(; j > 0 && c < letters_[j-1]; --j){}
+                if(j > 0 && letters_[j-1] == c){
+                    continue;
+                }
+                for(size_type k = letter_count_; k > j; --k){
+                    letters_[k] = letters_[k-1];
+                }
+                letters_[j] = c;
+                ++letter_count_;
+            }
+        }
+        for(size_type b = 0; b < 256; ++b){
+            byte_columns_[b] = static_cast<index_type>(Columns - 1);
+        }
+        if(sizeof(Char) == 1){
+            for(size_type j = 0; j < letter_count_; ++j){
+                byte_columns_[static_cast<unsigned char>(letters_[j])] = static_cast<index_type>(j);
+            }
+        }
+    }
+
+    constexpr void build_trie(detail::carray<detail::pattern_view<Char>, Count> const& views)
+    {
+        for(size_type s = 0; s < States; ++s){
+            output_[s] = static_cast<index_type>(Count);
+        }
+        size_type states = 1;
+        for(size_type p = 0; p < Count; ++p){
+            size_type state = 0;
+            for(size_type i = 0; i < views[p].size; ++i){
+                index_type& next = delta_[state * Columns + column(views[p].data[i])];
+                if(next == 0){
+                    next = static_cast<index_type>(states++);
+                }
+                state = next;
+            }
+            if(output_[state] != Count){
+                throw std::invalid_argument("duplicate pattern in multi_matcher");
+            }
+            output_[state] = static_cast<index_type>(p);
+            lengths_[p] = views[p].size;
+        }
+    }
+
+    // breadth first, so that the row of fail_[u] is complete before u's
+    constexpr void build_links()
+    {
+        detail::carray<index_type, States> queue{};
+        size_type head = 0, tail = 0;
+        queue[tail++] = 0;
+        while(head < tail){
+            size_type const u = queue[head++];
+            for(size_type c = 0; c + 1 < Columns; ++c){
+                index_type& next = delta_[u * Columns + c];
+                if(next != 0){
+                    size_type const v = next;
+                    fail_[v] = u == 0 ? 0 : delta_[fail_[u] * Columns + c];
+                    dict_[v] = output_[fail_[v]] != Count ? fail_[v] : dict_[fail_[v]];
+                    queue[tail++] = static_cast<index_type>(v);
+                }else if(u != 0){
+                    next = delta_[fail_[u] * Columns + c];
+                }
+            }
+        }
+    }
+
+    detail::carray<Char, Columns> letters_;
+    size_type letter_count_;
+    detail::carray<index_type, 256> byte_columns_;
+    detail::carray<index_type, States * Columns> delta_;
+    detail::carray<index_type, States> fail_;
+    detail::carray<index_type, States> output_;
+    detail::carray<index_type, States> dict_;
+    detail::carray<size_type, Count> lengths_;
+};
+
+template<class Char, size_t Count, size_t States, size_t Columns>
+constexpr typename multi_matcher<Char, Count, States, Columns>::size_type multi_matcher<Char, Count, States, Columns>::npos;
+
+namespace detail {
+
+    template<class... Patterns>
+    struct multi_matcher_of{
+        typedef typename pattern_source<alias::remove_cv<alias::remove_reference<
+                    typename std::tuple_element<0, std::tuple<Patterns...>>::type>>>::char_type char_type;
+        static constexpr size_t total = pattern_capacity<alias::remove_cv<alias::remove_reference<Patterns>>...>::value;
+        static constexpr size_t letters = sizeof(char_type) == 1 && total > 256 ? 256 : total;
+
+        typedef multi_matcher<char_type, sizeof...(Patterns), total + 1, letters + 1> type;
+    };
+
+} // namespace detail
+
+// @brief: the automaton of frozen::basic_string, string literal or
+//         frozen::meta::basic_string patterns.
+//
+//   constexpr auto m = frozen::make_multi_matcher("ERROR", "WARN", "timeout");
+//   auto const r = m.find(line);   // r.pattern == 1, r.position == 5 for "[at] WARN ..."
+template<class... Patterns>
+inline constexpr
+typename detail::multi_matcher_of<Patterns...>::type make_multi_matcher(Patterns const&... patterns)
+{
+    // the views may point to temporaries, which live until the automaton is built
+    return typename detail::multi_matcher_of<Patterns...>::type(
+               detail::pattern_views<typename detail::multi_matcher_of<Patterns...>::char_type>(
+                   detail::pattern_source<alias::remove_cv<alias::remove_reference<Patterns>>>::get(patterns)...));
+}
+
+#if defined FROZEN_HAS_AUTO_NTTP
+// @brief: the automaton of constexpr patterns with static storage duration
+//
+//   static constexpr auto error = frozen::make_string("ERROR");
+//   static constexpr auto warn = frozen::make_string("WARN");
+//   frozen::static_multi_matcher<error, warn>.find(line);
+template<auto const&... Patterns>
+inline constexpr auto static_multi_matcher = make_multi_matcher(Patterns...);
+#endif
+
+} // namespace frozen
+
+#endif    // FROZEN_STRING_MULTI_MATCHER_HPP_INCLUDED
@@ -0,0 +1,302 @@
+#if !defined FROZEN_STRING_REGEX_HPP_INCLUDED
+#define      FROZEN_STRING_REGEX_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../type_traits_aliases.hpp"
+#include "./detail/macros.hpp"
+#include "./detail/carray.hpp"
+#include "./detail/regex.hpp"
+#include "./detail/search.hpp"
+#include "./detail/string_like.hpp"
+#include "./detail/string_constant.hpp"
+#include "./detail/util.hpp"
+#include "./basic_string.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+namespace detail {
+
+    template<class Index, size_t M, size_t C, size_t S>
+    inline constexpr carray<Index, M * C> regex_delta(regex_dfa<C, S> const& dfa)
+    {
+        carray<Index, M * C> r{};
+        for(size_t i = 0; i < M * C; ++i){
+            r[i] = static_cast<Index>(dfa.delta[i]);
+        }
+        return r;
+    }
+
+    template<size_t M, size_t C, size_t S>
+    inline constexpr carray<bool, M> regex_accept(regex_dfa<C, S> const& dfa)
+    {
+        carray<bool, M> r{};
+        for(size_t s = 0; s < M; ++s){
+            r[s] = dfa.accept[s];
+        }
+        return r;
+    }
+
+    template<size_t I, size_t P, size_t R>
+    inline constexpr carray<regex_code, I> regex_interval_starts(regex_glushkov<P, R> const& g)
+    {
+        carray<regex_code, I> r{};
+        for(size_t k = 0; k < I; ++k){
+            r[k] = g.interval_starts[k];
+        }
+        return r;
+    }
+
+    template<class Index, size_t I, size_t P, size_t R>
+    inline constexpr carray<Index, I> regex_interval_classes(regex_glushkov<P, R> const& g)
+    {
+        carray<Index, I> r{};
+        for(size_t k = 0; k < I; ++k){
+            r[k] = static_cast<Index>(g.interval_class[k]);
+        }
+        return r;
+    }
+
+    // the interval of c is the last one which starts at or before c
+    template<size_t I>
+    inline constexpr size_t regex_interval_of(carray<regex_code, I> const& starts, regex_code c) noexcept
+    {
+        size_t first = 1, last = I;
+        while(first < last){
+            size_t const mid = first + (last - first) / 2;
+            if(starts[mid] <= c){
+                first = mid + 1;
+            }else{
+                last = mid;
+            }
+        }
+        return first - 1;
+    }
+
+    template<class Index, size_t B, size_t I>
+    inline constexpr carray<Index, B> regex_byte_classes(carray<regex_code, I> const& starts, carray<Index, I> const& classes)
+    {
+        carray<Index, B> r{};
+        for(size_t b = 0; b < B; ++b){
+            r[b] = classes[detail::regex_interval_of(starts, b)];
+        }
+        return r;
+    }
+
+    // the compilation stages of a pattern, each one a constant of the class
+    template<class Pattern>
+    struct regex_automaton{
+        typedef string_constant<Pattern> pattern;
+        typedef typename pattern::char_type char_type;
+        static constexpr size_t size = pattern::size;
+
+        static constexpr carray<char_type, size + 1> chars = pattern::chars();
+        static constexpr regex_counter counts = detail::regex_count_of<char_type, size>(chars.data);
+
+        typedef regex_glushkov<counts.positions, counts.ranges> glushkov_type;
+        static constexpr glushkov_type glushkov =
+            detail::regex_glushkov_of<char_type, size, counts.positions, counts.ranges>(chars.data);
+        static constexpr size_t intervals = glushkov.intervals;
+        static constexpr size_t classes = glushkov.classes;
+
+        typedef regex_dfa<classes, regex_dfa_capacity<counts.positions>::value> dfa_type;
+        static constexpr dfa_type dfa = detail::regex_dfa_of<classes, regex_dfa_capacity<counts.positions>::value>(glushkov);
+        static constexpr size_t states = dfa.states;
+
+        // finds where the first match ends; not built for ^ patterns
+        static constexpr dfa_type unanchored_dfa = glushkov.anchored_begin ? dfa_type{} :
+            detail::regex_dfa_of<classes, regex_dfa_capacity<counts.positions>::value>(glushkov, true);
+        static constexpr size_t unanchored_states = unanchored_dfa.states;
+
+        // runtime tables
+        static constexpr size_t max_index = states > unanchored_states ? states : unanchored_states;
+        typedef uint_least_for<(max_index > intervals ? max_index : intervals)> index_type;
+        typedef carray<index_type, states * classes> delta_type;
+        typedef carray<bool, states> accept_type;
+        typedef carray<index_type, unanchored_states * classes> unanchored_delta_type;
+        typedef carray<bool, unanchored_states> unanchored_accept_type;
+        typedef carray<regex_code, intervals> interval_starts_type;
+        typedef carray<index_type, intervals> interval_classes_type;
+        typedef carray<index_type, sizeof(char_type) == 1 ? 256 : 1> byte_classes_type;
+
+        static constexpr size_t start = dfa.start;
+        static constexpr bool anchored_begin = glushkov.anchored_begin;
+        static constexpr bool anchored_end = glushkov.anchored_end;
+        static constexpr delta_type delta = detail::regex_delta<index_type, states>(dfa);
+        static constexpr accept_type accept = detail::regex_accept<states>(dfa);
+        static constexpr size_t unanchored_start = unanchored_dfa.start;
+        static constexpr unanchored_delta_type unanchored_delta = detail::regex_delta<index_type, unanchored_states>(unanchored_dfa);
+        static constexpr unanchored_accept_type unanchored_accept = detail::regex_accept<unanchored_states>(unanchored_dfa);
+        static constexpr interval_starts_type interval_starts = detail::regex_interval_starts<intervals>(glushkov);
+        static constexpr interval_classes_type interval_classes = detail::regex_interval_classes<index_type, intervals>(glushkov);
+        static constexpr byte_classes_type byte_classes =
+            detail::regex_byte_classes<index_type, sizeof(char_type) == 1 ? 256 : 1>(interval_starts, interval_classes);
+    };
+
+    template<class Pattern>
+    constexpr typename regex_automaton<Pattern>::delta_type regex_automaton<Pattern>::delta;
+    template<class Pattern>
+    constexpr typename regex_automaton<Pattern>::accept_type regex_automaton<Pattern>::accept;
+    template<class Pattern>
+    constexpr typename regex_automaton<Pattern>::unanchored_delta_type regex_automaton<Pattern>::unanchored_delta;
+    template<class Pattern>
+    constexpr typename regex_automaton<Pattern>::unanchored_accept_type regex_automaton<Pattern>::unanchored_accept;
+    template<class Pattern>
+    constexpr typename regex_automaton<Pattern>::interval_starts_type regex_automaton<Pattern>::interval_starts;
+    template<class Pattern>
+    constexpr typename regex_automaton<Pattern>::interval_classes_type regex_automaton<Pattern>::interval_classes;
+    template<class Pattern>
+    constexpr typename regex_automaton<Pattern>::byte_classes_type regex_automaton<Pattern>::byte_classes;
+
+} // namespace detail
+
+// @brief: regular expression compiled at compile-time to a minimal DFA.
+//         Pattern is the type of the pattern: a frozen::meta::basic_string,
+//         or (C++17) detail::static_string of a constexpr string, see
+//         static_regex.  Matching reads one table entry per character and
+//         never allocates; an invalid pattern does not compile.
+//
+//   typedef frozen::regex<frozen::meta::basic_string<char, 'a', '+', 'b'>> re;
+//   re::match("aab");          // the whole string
+//   re::search("xxab");        // .position == 2, .length == 2
+//
+// The syntax is a subset of ECMAScript, see detail/regex.hpp; search()
+// returns the leftmost match and, of those, the longest one.
+template<class Pattern>
+class regex{
+    typedef detail::regex_automaton<Pattern> automaton;
+
+public:
+    typedef typename automaton::char_type char_type;
+    typedef size_t size_type;
+
+    static constexpr size_type npos = detail::npos;
+
+    // position is npos if there is no match
+    struct result{
+        size_type position;
+        size_type length;
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return position != npos;
+        }
+    };
+
+    // @brief: whether the whole of [s, s+n) matches
+    static constexpr bool match(char_type const* s, size_type n)
+    {
+        size_type state = automaton::start;
+        for(size_type i = 0; i < n && state != 0; ++i){
+            state = step(state, s[i]);
+        }
+        return automaton::accept[state];
+    }
+
+    template<class String>
+    static constexpr auto match(String const& s)
+        -> decltype(detail::size_of(s) != 0)
+    {
+        return match(detail::data_of(s), detail::size_of(s));
+    }
+
+    // @brief: the leftmost longest match which begins at or after pos
+    static constexpr result search(char_type const* s, size_type n, size_type pos)
+    {
+        size_type const end_begin = begins_to_try(s, n, pos);
+        for(size_type begin = pos; begin < end_begin; ++begin){
+            size_type state = automaton::start;
+            size_type length = accepts(state, begin, n) ? 0 : npos;
+            for(size_type i = begin; i < n && state != 0; ++i){
+                state = step(state, s[i]);
+                length = accepts(state, i + 1, n) ? i + 1 - begin : length;
+            }
+            if(length != npos){
+                return {begin, length};
+            }
+        }
+        return {npos, 0};
+    }
+
+    template<class String>
+    static constexpr auto search(String const& s, size_type pos = 0)
+        -> decltype(static_cast<void>(detail::size_of(s)), result())
+    {
+        return search(detail::data_of(s), detail::size_of(s), pos);
+    }
+
+    // @brief: the number of states of the minimal DFA, the dead state included
+    static constexpr size_type state_count() noexcept
+    {
+        return automaton::states;
+    }
+
+    // @brief: the number of classes of characters which the pattern tells apart
+    static constexpr size_type class_count() noexcept
+    {
+        return automaton::classes;
+    }
+
+private:
+    static constexpr size_type column(char_type c) noexcept
+    {
+        return sizeof(char_type) == 1 ?
+                   automaton::byte_classes[static_cast<unsigned char>(c)] :
+                   automaton::interval_classes[detail::regex_interval_of(automaton::interval_starts, detail::regex_code_of(c))];
+    }
+
+    static constexpr size_type step(size_type state, char_type c) noexcept
+    {
+        return automaton::delta[state * automaton::classes + column(c)];
+    }
+
+    static constexpr bool accepts(size_type state, size_type end, size_type n) noexcept
+    {
+        return automaton::accept[state] && (!automaton::anchored_end || end == n);
+    }
+
+    // one past the last begin which search() has to try: the leftmost match
+    // begins at or before the end of the first match to end, which the
+    // unanchored DFA finds in one pass, or pos if there is no match
+    static constexpr size_type begins_to_try(char_type const* s, size_type n, size_type pos) noexcept
+    {
+        if(pos > n){
+            return pos;
+        }
+        if(automaton::anchored_begin){
+            return pos == 0 ? 1 : 0;
+        }
+        if(automaton::unanchored_states == 0){
+            return n + 1;
+        }
+        size_type state = automaton::unanchored_start;
+        for(size_type i = pos; ; ++i){
+            if(automaton::unanchored_accept[state] && (!automaton::anchored_end || i == n)){
+                return i + 1;
+            }
+            if(i == n){
+                return pos;
+            }
+            state = automaton::unanchored_delta[state * automaton::classes + column(s[i])];
+        }
+    }
+};
+
+template<class Pattern>
+constexpr typename regex<Pattern>::size_type regex<Pattern>::npos;
+
+#if defined FROZEN_HAS_AUTO_NTTP
+// @brief: the regex of a constexpr string with static storage duration
+//
+//   static constexpr auto date = frozen::make_string("\\d{4}-\\d{2}-\\d{2}");
+//   frozen::static_regex<date>.match(line);
+template<auto const& Pattern>
+inline constexpr regex<detail::static_string<Pattern>> static_regex{};
+#endif
+
+} // namespace frozen
+
+#endif    // FROZEN_STRING_REGEX_HPP_INCLUDED
@@ -0,0 +1,220 @@
+#if !defined FROZEN_STRING_SEARCHER_HPP_INCLUDED
+#define      FROZEN_STRING_SEARCHER_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+#include "../type_traits_aliases.hpp"
+#include "./detail/macros.hpp"
+#include "./detail/indices.hpp"
+#include "./detail/array_wrapper.hpp"
+#include "./detail/search.hpp"
+#include "./detail/string_like.hpp"
+#include "./detail/util.hpp"
+#include "./basic_string.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+namespace detail {
+
+    // characters are hashed to their low byte; a shift is then the minimum
+    // of the characters sharing it, which is still safe for wide strings
+    template<class Char>
+    inline constexpr unsigned char byte_of(Char c) noexcept
+    {
+        return static_cast<unsigned char>(c);
+    }
+
+    template<class Char>
+    struct byte_is{
+        Char const* s;
+        unsigned char b;
+
+        constexpr bool operator()(size_t idx) const
+        {
+            return detail::byte_of(s[idx]) == b;
+        }
+    };
+
+    // Horspool's shift for the byte b: the distance from the last occurrence
+    // in needle[0, m-1) to the end of the needle, or m
+    template<class Char>
+    inline constexpr size_t horspool_shift_found(size_t m, size_t found) noexcept
+    {
+        return found == npos ? m : m - 1 - found;
+    }
+
+    template<class Char>
+    inline constexpr size_t horspool_shift(Char const* needle, size_t m, unsigned char b)
+    {
+        return m == 0 ? 0 : detail::horspool_shift_found<Char>(m, impl::find_last_if_impl(byte_is<Char>{needle, b}, 0, m - 1));
+    }
+
+    template<class Index, class Char, size_t... Indices>
+    inline constexpr array_wrapper<Index, sizeof...(Indices)> horspool_table(Char const* needle, size_t m, indices<Indices...>)
+    {
+        return {{ static_cast<Index>(detail::horspool_shift(needle, m, static_cast<unsigned char>(Indices)))... }};
+    }
+
+} // namespace detail
+
+// @brief: Boyer-Moore-Horspool searcher of a fixed needle.  The shift table is
+//         built when the searcher is constructed, so a constexpr searcher has
+//         it in read-only data.  It can be passed to std::search() (C++17) or
+//         used on its own.
+//
+//   constexpr auto s = frozen::make_searcher(frozen::make_string("ERROR"));
+//   s.find(line);                               // index or npos
+//   std::search(line.begin(), line.end(), s);   // iterator pair
+template<class Char, size_t N>
+class searcher{
+public:
+    typedef size_t size_type;
+    typedef detail::uint_least_for<N> shift_type;
+
+    static constexpr size_type npos = detail::npos;
+
+    constexpr explicit searcher(basic_string<Char, N> const& needle)
+        : needle_(needle),
+          shifts_(detail::horspool_table<shift_type>(needle.data(), needle.size(), detail::make_indices<0, 256>()))
+    {}
+
+    constexpr basic_string<Char, N> const& needle() const noexcept
+    {
+        return needle_;
+    }
+
+    constexpr size_type shift(Char c) const noexcept
+    {
+        return shifts_[detail::byte_of(c)];
+    }
+
+    // @brief: the first index >= pos where the needle begins in [s, s+n), or npos
+    constexpr size_type find(Char const* s, size_type n, size_type pos) const
+    {
+        return FROZEN_IS_CONSTANT_EVALUATED() ?
+                   detail::impl::find_constexpr(s, n, needle_.data(), needle_.size(), pos) :
+                   find_runtime(s, n, pos);
+    }
+
+    template<class String>
+    constexpr auto find(String const& s, size_type pos = 0) const
+        -> decltype(detail::size_of(s))
+    {
+        return this->find(detail::data_of(s), detail::size_of(s), pos);
+    }
+
+    // the searcher interface of std::search()
+    template<class RandomAccessIterator>
+    std::pair<RandomAccessIterator, RandomAccessIterator>
+    operator()(RandomAccessIterator first, RandomAccessIterator last) const
+    {
+        size_type const m = needle_.size();
+        size_type const n = static_cast<size_type>(last - first);
+        if(m == 0){
+            return {first, first};
+        }
+        for(size_type i = 0; i + m <= n; i += shift(first[i + m - 1])){
+            size_type j = m;
+            for(; j > 0 && first[i + j - 1] == needle_.data()[j - 1]; --j){}
+            if(j == 0){
+                return {first + i, first + i + m};
+            }
+        }
+        return {last, last};
+    }
+
+    std::pair<Char const*, Char const*> operator()(Char const* first, Char const* last) const
+    {
+        size_type const idx = find_runtime(first, static_cast<size_type>(last - first), 0);
+        return idx == npos ? std::make_pair(last, last) : std::make_pair(first + idx, first + idx + needle_.size());
+    }
+
+private:
+    size_type find_runtime(Char const* s, size_type n, size_type pos) const
+    {
+        size_type const m = needle_.size();
+        Char const* const needle = needle_.data();
+        if(m > n || pos > n - m){
+            return npos;
+        }
+        if(m == 0){
+            return pos;
+        }
+
+        size_type i = pos;
+#if defined __GNUC__ && defined __BYTE_ORDER__ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        // one-byte characters: compare the first and the last character at 16
+        // positions at once and verify only the positions where both match;
+        // the shift table is used for the rest and for wide characters
+        if(sizeof(Char) == 1 && m >= 2){
+            typedef unsigned char block_type __attribute__((vector_size(16)));
+            block_type first_block, last_block;
+            std::memset(&first_block, static_cast<unsigned char>(needle[0]), sizeof(block_type));
+            std::memset(&last_block, static_cast<unsigned char>(needle[m - 1]), sizeof(block_type));
+            for(; i + m - 1 + 16 <= n; i += 16){
+                block_type a, b;
+                std::memcpy(&a, s + i, sizeof(block_type));
+                std::memcpy(&b, s + i + m - 1, sizeof(block_type));
+                auto const eq = (a == first_block) & (b == last_block);
+                std::uint64_t words[2];
+                std::memcpy(words, &eq, sizeof(words));
+                if((words[0] | words[1]) == 0){
+                    continue;
+                }
+                for(size_type w = 0; w < 2; ++w){
+                    for(std::uint64_t bits = words[w] & 0x8080808080808080ull; bits != 0; bits &= bits - 1){
+                        size_type const idx = i + w * 8 + static_cast<size_type>(__builtin_ctzll(bits)) / 8;
+                        if(std::memcmp(s + idx + 1, needle + 1, m - 2) == 0){
+                            return idx;
+                        }
+                    }
+                }
+            }
+        }
+#endif
+
+        for(; i + m <= n; i += shift(s[i + m - 1])){
+            if(s[i + m - 1] == needle[m - 1] && std::char_traits<Char>::compare(s + i, needle, m - 1) == 0){
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    basic_string<Char, N> needle_;
+    detail::array_wrapper<shift_type, 256> shifts_;
+};
+
+template<class Char, size_t N>
+constexpr typename searcher<Char, N>::size_type searcher<Char, N>::npos;
+
+template<class Char, size_t N>
+inline constexpr searcher<Char, N> make_searcher(basic_string<Char, N> const& needle)
+{
+    return searcher<Char, N>(needle);
+}
+
+template<class Char, size_t N>
+inline constexpr searcher<Char, N> make_searcher(Char const (&needle)[N])
+{
+    return searcher<Char, N>(basic_string<Char, N>(needle));
+}
+
+#if defined FROZEN_HAS_AUTO_NTTP
+// @brief: the searcher of a constexpr string with static storage duration
+//
+//   static constexpr auto needle = frozen::make_string("ERROR");
+//   frozen::static_searcher<needle>.find(line);
+template<auto const& Needle>
+inline constexpr auto static_searcher = make_searcher(Needle);
+#endif
+
+} // namespace frozen
+
+#endif    // FROZEN_STRING_SEARCHER_HPP_INCLUDED
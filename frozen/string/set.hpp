@@ -0,0 +1,95 @@
+#if !defined FROZEN_STRING_SET_HPP_INCLUDED
+#define      FROZEN_STRING_SET_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+
+#include "./basic_string.hpp"
+#include "./detail/indices.hpp"
+#include "./detail/string_like.hpp"
+#include "./detail/pmh.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+// Immutable set of basic_string built at compile-time.  See frozen::map.
+//
+//   constexpr frozen::set<frozen::string<8>, 3> verbs = {"GET", "POST", "PUT"};
+//   verbs.contains("PUT"); // true
+template<class Key, size_t N>
+class set{
+    FROZEN_STATIC_ASSERT(N > 0);
+
+public:
+    typedef Key key_type;
+    typedef Key value_type;
+    typedef value_type const& const_reference;
+    typedef value_type const* const_iterator;
+    typedef size_t size_type;
+
+    constexpr set(std::initializer_list<value_type> keys)
+        : set(keys.size() == N ? keys.begin() : throw std::invalid_argument("frozen::set: wrong number of keys"),
+              detail::make_indices<0, N>())
+    {}
+
+    constexpr const_iterator begin() const noexcept
+    {
+        return keys_;
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+        return keys_ + N;
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return N;
+    }
+
+    constexpr bool empty() const noexcept
+    {
+        return false;
+    }
+
+    template<class String>
+    constexpr const_iterator find(String const& key) const
+    {
+        return find_at(table_.lookup(detail::hash_of(key)), key);
+    }
+
+    template<class String>
+    constexpr size_type count(String const& key) const
+    {
+        return find(key) != end();
+    }
+
+    template<class String>
+    constexpr bool contains(String const& key) const
+    {
+        return find(key) != end();
+    }
+
+private:
+    template<size_t... Indices>
+    constexpr set(value_type const* keys, detail::indices<Indices...>)
+        : keys_{keys[Indices]...}
+        , table_(detail::carray<std::uint64_t, N>{{keys[Indices].hash()...}})
+    {}
+
+    template<class String>
+    constexpr const_iterator find_at(size_t idx, String const& key) const
+    {
+        return idx != N && detail::string_equal(keys_[idx], key) ? keys_ + idx : end();
+    }
+
+    value_type const keys_[N];
+    detail::pmh_table<N> const table_;
+};
+
+} // namespace frozen
+
+#endif    // FROZEN_STRING_SET_HPP_INCLUDED
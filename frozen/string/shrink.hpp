@@ -0,0 +1,66 @@
+#if !defined FROZEN_STRING_SHRINK_HPP_INCLUDED
+#define      FROZEN_STRING_SHRINK_HPP_INCLUDED
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "./detail/indices.hpp"
+#include "./detail/array_wrapper.hpp"
+#include "./detail/macros.hpp"
+#include "./basic_string.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+namespace detail {
+
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+    template<size_t M, class Char, size_t N>
+    inline constexpr
+    basic_string<Char, M> shrink_to_impl(basic_string<Char, N> const& s, detail::copy_loop<basic_string<Char, M>::len>)
+    {
+        return detail::make_array_wrapper<Char, basic_string<Char, M>::len>(s.data(), s.size());
+    }
+#else
+    template<size_t M, class Char, size_t N, size_t... Indices>
+    inline constexpr
+    basic_string<Char, M> shrink_to_impl(basic_string<Char, N> const& s, detail::indices<Indices...>)
+    {
+        return detail::array_wrapper<Char, basic_string<Char, M>::len>{{
+                   (Indices < s.size() ? s[Indices] : static_cast<Char>('\0'))...
+               }};
+    }
+#endif
+
+} // namespace detail
+
+// @brief: copy s into a string of capacity M.  M must be greater than s.size().
+template<size_t M, class Char, size_t N>
+inline constexpr
+basic_string<Char, M> shrink_to(basic_string<Char, N> const& s)
+{
+    return s.size() < basic_string<Char, M>::len ?
+               detail::shrink_to_impl<M>(s, detail::copy_indices<basic_string<Char, M>::len>()) :
+               throw std::length_error("shrink_to: capacity is smaller than the string");
+}
+
+#if defined FROZEN_HAS_AUTO_NTTP
+// @brief: S is a constexpr string with static storage duration.
+//         The result has exactly the capacity S.size()+1.
+template<auto const& S>
+inline constexpr
+auto shrink()
+{
+    return frozen::shrink_to<S.size()+1>(S);
+}
+#endif
+
+} // namespace frozen
+
+// re-type a constant expression of basic_string to the capacity of its
+// logical length (plus '\0'), e.g. auto constexpr s = FROZEN_SHRINK(a + b + 42);
+#define FROZEN_SHRINK(...) \
+    frozen::shrink_to<(__VA_ARGS__).size()+1>(__VA_ARGS__)
+
+#endif    // FROZEN_STRING_SHRINK_HPP_INCLUDED
@@ -0,0 +1,183 @@
+#if !defined FROZEN_STRING_SORTED_SET_HPP_INCLUDED
+#define      FROZEN_STRING_SORTED_SET_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "./basic_string.hpp"
+#include "./detail/indices.hpp"
+#include "./detail/string_like.hpp"
+#include "./detail/compare.hpp"
+#include "./detail/eytzinger.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+// Immutable ordered set of basic_string built at compile-time.
+//
+//   constexpr frozen::sorted_set<frozen::string<8>, 3> verbs = {"PUT", "GET", "POST"};
+//   *verbs.begin();                   // "GET"
+//   verbs.lower_bound("H");           // "POST"
+//   verbs.prefix_range("P");          // ["POST", "PUT")
+//
+// The keys are given in any order; they are sorted while the set is
+// constructed and duplicates are rejected.  Iteration is in sorted order.
+// Lookups descend an implicit search tree stored in breadth first
+// (Eytzinger) order whose nodes hold the first characters of their key
+// packed in an integer, so most steps compare one integer and touch
+// neighbouring cache lines only; the keys themselves are read when two
+// prefixes are equal.  Unlike frozen::set, range and prefix queries work.
+template<class Key, size_t N>
+class sorted_set{
+    FROZEN_STATIC_ASSERT(N > 0);
+
+    typedef typename Key::value_type char_type;
+    typedef detail::eytzinger_tree<char_type, N> tree_type;
+    typedef typename tree_type::node_type node_type;
+    typedef detail::eytzinger_prefix<char_type> prefix_type;
+
+public:
+    typedef Key key_type;
+    typedef Key value_type;
+    typedef value_type const& const_reference;
+    typedef value_type const* const_iterator;
+    typedef size_t size_type;
+
+    constexpr sorted_set(std::initializer_list<value_type> keys)
+        : sorted_set(keys.size() == N ? keys.begin() : throw std::invalid_argument("frozen::sorted_set: wrong number of keys"),
+                     detail::make_indices<0, N>())
+    {}
+
+    constexpr const_iterator begin() const noexcept
+    {
+        return keys_;
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+        return keys_ + N;
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return N;
+    }
+
+    constexpr bool empty() const noexcept
+    {
+        return false;
+    }
+
+    // @brief: the first key which is not less than key
+    template<class String>
+    constexpr const_iterator lower_bound(String const& key) const
+    {
+        return keys_ + tree_.partition_point(less_than{keys_, detail::data_of(key), detail::size_of(key)});
+    }
+
+    // @brief: the first key which is greater than key
+    template<class String>
+    constexpr const_iterator upper_bound(String const& key) const
+    {
+        return upper_at(lower_bound(key), key);
+    }
+
+    template<class String>
+    constexpr std::pair<const_iterator, const_iterator> equal_range(String const& key) const
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template<class String>
+    constexpr const_iterator find(String const& key) const
+    {
+        return find_at(lower_bound(key), key);
+    }
+
+    template<class String>
+    constexpr size_type count(String const& key) const
+    {
+        return find(key) != end();
+    }
+
+    template<class String>
+    constexpr bool contains(String const& key) const
+    {
+        return find(key) != end();
+    }
+
+    // @brief: the keys which start with prefix, in sorted order
+    template<class String>
+    constexpr std::pair<const_iterator, const_iterator> prefix_range(String const& prefix) const
+    {
+        return {lower_bound(prefix),
+                keys_ + tree_.partition_point(not_after{keys_, detail::data_of(prefix), detail::size_of(prefix)})};
+    }
+
+private:
+    // the keys are copied in sorted order, basic_string is not assignable
+    template<size_t... Indices>
+    constexpr sorted_set(value_type const* keys, detail::indices<Indices...>)
+        : sorted_set(keys, detail::eytzinger_order<N>(keys), detail::indices<Indices...>())
+    {}
+
+    template<size_t... Indices>
+    constexpr sorted_set(value_type const* keys, detail::carray<size_t, N> const& order, detail::indices<Indices...>)
+        : keys_{keys[order[Indices]]...}
+        , tree_(keys_)
+    {}
+
+    template<class String>
+    constexpr const_iterator upper_at(const_iterator it, String const& key) const
+    {
+        return it != end() && detail::string_equal(*it, key) ? it + 1 : it;
+    }
+
+    template<class String>
+    constexpr const_iterator find_at(const_iterator it, String const& key) const
+    {
+        return it != end() && detail::string_equal(*it, key) ? it : end();
+    }
+
+    // whether the key of a node is less than [s, s+n)
+    struct less_than{
+        value_type const* keys;
+        char_type const* s;
+        size_t n;
+        std::uint64_t prefix;
+
+        constexpr less_than(value_type const* k, char_type const* str, size_t size)
+            : keys(k), s(str), n(size), prefix(prefix_type::of(str, size))
+        {}
+
+        constexpr bool operator()(node_type const& node) const
+        {
+            return node.prefix != prefix ?
+                       node.prefix < prefix :
+                       detail::compare(keys[node.rank].data(), keys[node.rank].size(), s, n) < 0;
+        }
+    };
+
+    // whether the key of a node is less than [s, s+n) or starts with it
+    struct not_after{
+        value_type const* keys;
+        char_type const* s;
+        size_t n;
+
+        constexpr bool operator()(node_type const& node) const
+        {
+            return detail::compare(keys[node.rank].data(), keys[node.rank].size() < n ? keys[node.rank].size() : n, s, n) <= 0;
+        }
+    };
+
+    value_type const keys_[N];
+    tree_type const tree_;
+};
+
+} // namespace frozen
+
+#endif    // FROZEN_STRING_SORTED_SET_HPP_INCLUDED
@@ -0,0 +1,156 @@
+#if !defined FROZEN_STRING_STRING_SWITCH_HPP_INCLUDED
+#define      FROZEN_STRING_STRING_SWITCH_HPP_INCLUDED
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../type_traits_aliases.hpp"
+#include "./detail/macros.hpp"
+#include "./detail/carray.hpp"
+#include "./detail/string_like.hpp"
+#include "./detail/string_constant.hpp"
+#include "./detail/label_table.hpp"
+
+namespace frozen {
+
+using std::size_t;
+
+// a case of string_switch(): Label is the type of a string constant
+template<class Label, class F>
+struct switch_case{
+    F f;
+};
+
+template<class F>
+struct switch_default{
+    F f;
+};
+
+template<class Label, class F>
+inline constexpr switch_case<Label, F> case_(F f)
+{
+    return {f};
+}
+
+#if defined FROZEN_HAS_AUTO_NTTP
+template<auto const& Label, class F>
+inline constexpr switch_case<detail::static_string<Label>, F> case_(F f)
+{
+    return {f};
+}
+#endif
+
+#if defined FROZEN_HAS_CLASS_TYPE_NTTP
+template<detail::fixed_literal Label, class F>
+inline constexpr switch_case<detail::literal_string<Label>, F> case_(F f)
+{
+    return {f};
+}
+#endif
+
+template<class F>
+inline constexpr switch_default<F> default_(F f)
+{
+    return {f};
+}
+
+namespace detail {
+
+    // the labels of the cases before the default one
+    template<class... Cases>
+    struct switch_labels_of;
+
+    template<class Default>
+    struct switch_labels_of<Default>{
+        typedef std::tuple<> type;
+    };
+
+    template<class Label, class F, class... Cases>
+    struct switch_labels_of<switch_case<Label, F>, Cases...>{
+        typedef decltype(std::tuple_cat(std::declval<std::tuple<Label>>(), std::declval<typename switch_labels_of<Cases...>::type>())) type;
+    };
+
+    template<class T>
+    struct is_switch_default : std::false_type
+    {};
+
+    template<class F>
+    struct is_switch_default<switch_default<F>> : std::true_type
+    {};
+
+    template<class T>
+    struct switch_result;
+
+    template<class Label, class F>
+    struct switch_result<switch_case<Label, F>>{
+        typedef decltype(std::declval<F const&>()()) type;
+    };
+
+    template<class F>
+    struct switch_result<switch_default<F>>{
+        typedef decltype(std::declval<F const&>()()) type;
+    };
+
+    // call the case idx; the last one is the default
+    template<class R, size_t I, class Cases>
+    inline constexpr R switch_call(size_t, Cases const& cases, std::true_type)
+    {
+        return std::get<I>(cases).f();
+    }
+
+    template<class R, size_t I, class Cases>
+    inline constexpr R switch_call(size_t idx, Cases const& cases, std::false_type)
+    {
+        return idx == I ?
+                   static_cast<R>(std::get<I>(cases).f()) :
+                   switch_call<R, I + 1>(idx, cases, std::integral_constant<bool, I + 2 == std::tuple_size<Cases>::value>());
+    }
+
+    template<class Char, class R, class String, class Cases>
+    inline constexpr R string_switch_impl(String const&, Cases const& cases, std::tuple<>*, R*)
+    {
+        return std::get<0>(cases).f();
+    }
+
+    template<class Char, class... Labels, class R, class String, class Cases>
+    inline constexpr R string_switch_impl(String const& input, Cases const& cases, std::tuple<Labels...>*, R*)
+    {
+        return switch_call<R, 0>(label_table<Char, Labels...>::find(detail::data_of(input), detail::size_of(input)), cases,
+                                 std::integral_constant<bool, std::tuple_size<Cases>::value == 1>());
+    }
+
+} // namespace detail
+
+// @brief: call the function of the case whose label is equal to input, or
+//         the default one.  The labels are compiled into a perfect hash of
+//         their lengths, of their lengths and the character at the position
+//         which tells them apart, or of all their characters, whichever is
+//         the first to be collision free; a dispatch is then one table
+//         lookup and one comparison.
+//
+//   frozen::string_switch(method,
+//       frozen::case_<"GET">([]{ return 1; }),        // C++20 literal
+//       frozen::case_<post>([]{ return 2; }),         // C++17 static constexpr string
+//       frozen::case_<frozen::meta::basic_string<char, 'P', 'U', 'T'>>([]{ return 3; }),
+//       frozen::default_([]{ return 0; }));
+//
+// The result is the common type of the results of the functions.
+template<class String, class... Cases>
+inline constexpr auto string_switch(String const& input, Cases const&... cases)
+    -> typename std::common_type<typename detail::switch_result<Cases>::type...>::type
+{
+    typedef typename std::common_type<typename detail::switch_result<Cases>::type...>::type result_type;
+    typedef std::tuple<Cases const&...> cases_type;
+    typedef typename std::tuple_element<sizeof...(Cases) - 1, std::tuple<Cases...>>::type last_type;
+    static_assert(detail::is_switch_default<last_type>::value, "frozen::string_switch: the last case must be default_()");
+
+    return detail::string_switch_impl<alias::remove_cv<alias::remove_pointer<decltype(detail::data_of(input))>>>(
+               input, cases_type(cases...), static_cast<typename detail::switch_labels_of<Cases...>::type*>(nullptr),
+               static_cast<result_type*>(nullptr));
+}
+
+} // namespace frozen
+
+#endif    // FROZEN_STRING_STRING_SWITCH_HPP_INCLUDED
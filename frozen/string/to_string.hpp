@@ -6,9 +6,14 @@
 #include <utility>
 
 #include "./detail/indices.hpp"
+#include "./detail/array_wrapper.hpp"
 #include "./detail/digits.hpp"
 #include "./detail/forward.hpp"
 #include "./detail/util.hpp"
+#include "./detail/macros.hpp"
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+#   include "./detail/shortest.hpp"
+#endif
 
 namespace frozen {
 
@@ -20,41 +25,44 @@ class basic_string;
 
 namespace detail {
 
-    template<class Char, class Int, size_t... Indices>
+    // u has the given number of digits; '-' is put in front of them if negative
+    template<class Char, size_t N, size_t... Indices>
     inline constexpr
-    alias::enable_if<
-        ! std::is_signed< alias::decay<Int> >::value,
-        basic_string<Char, detail::int_max_digits10<Int>()>
-    >
-    to_basic_string_integral(Int i, size_t digits, indices<Indices...>)
+    basic_string<Char, N> to_basic_string_integral(bool negative, unsigned long long u, size_t digits, indices<Indices...>)
     {
         return {{{
                     static_cast<Char>(
-                            Indices < digits ? detail::digits10_at(i, digits-Indices-1) + '0' : '\0'
+                        negative && Indices == 0 ? '-' :
+                        Indices - negative < digits ? detail::digits10_char_at(u, digits - 1 - (Indices - negative)) : '\0'
                     )...
                }}};
     }
 
-    template<class Char, class Int, size_t... Indices>
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+    // writes two digits per step from the end, which is also fast at runtime
+    template<class Char, size_t N>
     inline constexpr
-    alias::enable_if<
-        std::is_signed< alias::decay<Int> >::value,
-        basic_string<Char, detail::int_max_digits10<Int>()>
-    >
-    to_basic_string_integral(Int i, size_t digits, indices<Indices...>)
+    basic_string<Char, N> to_basic_string_integral(bool negative, unsigned long long u, size_t digits)
     {
-        return {{{
-                    static_cast<Char>( i < 0 ?
-                        (
-                            Indices == 0 ? '-' :
-                            Indices-1 < digits ? detail::digits10_at(-i, digits-(Indices-1)-1) + '0' : '\0'
-                        ) :
-                        (
-                            Indices < digits ? detail::digits10_at(i, digits-Indices-1) + '0' : '\0'
-                        )
-                    )...
-            }}};
+        detail::array_wrapper<Char, N> buf{};
+        size_t pos = digits + negative;
+        for(; u >= 100; u /= 100){
+            size_t const pair = 2 * (u % 100);
+            buf.data[--pos] = static_cast<Char>(digits_tables<>::pairs[pair + 1]);
+            buf.data[--pos] = static_cast<Char>(digits_tables<>::pairs[pair]);
+        }
+        if(u >= 10){
+            buf.data[--pos] = static_cast<Char>(digits_tables<>::pairs[2 * u + 1]);
+            buf.data[--pos] = static_cast<Char>(digits_tables<>::pairs[2 * u]);
+        }else{
+            buf.data[--pos] = static_cast<Char>('0' + u);
+        }
+        if(negative){
+            buf.data[0] = static_cast<Char>('-');
+        }
+        return buf;
     }
+#endif
 
 } // namespace detail
 
@@ -66,11 +74,20 @@ template< class Char, class T,
 inline constexpr
 basic_string<Char, detail::int_max_digits10<T>()> to_basic_string(T t)
 {
-    return detail::to_basic_string_integral<Char>(
-                t,
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+    return detail::to_basic_string_integral<Char, detail::int_max_digits10<T>()>(
+                t < T(),
+                detail::magnitude_of(t),
+                detail::digits10_of(t)
+            );
+#else
+    return detail::to_basic_string_integral<Char, detail::int_max_digits10<T>()>(
+                t < T(),
+                detail::magnitude_of(t),
                 detail::digits10_of(t),
                 detail::make_indices<0, detail::int_max_digits10<T>()>()
             );
+#endif
 }
 
 
@@ -131,12 +148,46 @@ namespace detail {
     basic_string<Char, N> remove_tail_zeros(basic_string<Char, N> const& s)
     {
         return remove_useless_dot(
-                remove_tail_zeros_impl(s, detail::strlen(s)-1, detail::make_indices<0, N>())
+                remove_tail_zeros_impl(s, s.size()-1, detail::make_indices<0, N>())
               , detail::make_indices<0, basic_string<Char, N>::len-1>() );
     }
 
 } // namespace detail
 
+#if defined FROZEN_HAS_RELAXED_CONSTEXPR
+
+namespace detail {
+
+    template<class Char, class Float, size_t... Indices>
+    inline constexpr
+    basic_string<Char, detail::float_shortest_max_chars<Float>::value + 1>
+    to_basic_string_shortest(float_chars<Float> const& c, indices<Indices...>)
+    {
+        return {{{
+                   static_cast<Char>( Indices < c.size ? c.data[Indices] : '\0' )...
+               }}};
+    }
+
+} // namespace detail
+
+// @brief: the shortest representation which reads back to the same value,
+//         like std::to_chars: "0.1", "1e+100", "123.45", "5e-324", "-0".
+template<class Char, class T,
+         class = alias::enable_if<
+                     std::is_floating_point< alias::decay<T> >::value
+                 >
+        >
+inline constexpr
+basic_string<Char, detail::float_shortest_max_chars<alias::decay<T>>::value + 1> to_basic_string(T t)
+{
+    return detail::to_basic_string_shortest<Char>(
+                detail::shortest_chars<alias::decay<T>>(t),
+                detail::make_indices<0, detail::float_shortest_max_chars<alias::decay<T>>::value + 1>()
+           );
+}
+
+#else
+
 template<class Char, class T,
          class = alias::enable_if<
                      std::is_floating_point< alias::decay<T> >::value
@@ -155,6 +206,8 @@ basic_string<Char, detail::float_max_digits10<T>::value> to_basic_string(T t)
            );
 }
 
+#endif
+
 template<class T>
 inline constexpr
 auto to_string(T t)
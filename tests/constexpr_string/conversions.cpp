@@ -1,5 +1,7 @@
 #include <string>
 #include <cassert>
+#include <cmath>
+#include <limits>
 
 #include "../util.hpp"
 
@@ -7,10 +9,68 @@
 
 using namespace frozen;
 
+// the minimum value has one more digit than the maximum after the '-'
+template<class T>
+constexpr bool round_trips(T t)
+{
+    return to_integer<T>(to_string(t)).value == t && to_integer<T>(to_string(t)).pos == to_string(t).size();
+}
+
+template<class T>
+void check_signed()
+{
+    SASSERT(round_trips(std::numeric_limits<T>::min()));
+    SASSERT(round_trips(std::numeric_limits<T>::max()));
+    SASSERT(round_trips(static_cast<T>(-1)));
+    assert(to_string(std::numeric_limits<T>::min()).to_std_string() == std::to_string(std::numeric_limits<T>::min()));
+    assert(to_string(std::numeric_limits<T>::max()).to_std_string() == std::to_string(std::numeric_limits<T>::max()));
+}
+
+template<class T>
+void check_billion()
+{
+    SASSERT(to_string(static_cast<T>(-1000000000)) == "-1000000000");
+    SASSERT(round_trips(static_cast<T>(-1000000000)));
+    check_signed<T>();
+}
+
 int main()
 {
     SASSERT(to_basic_string<char>(42) == make_string("42"));
     SASSERT(to_basic_string<char>(-423) == make_string("-423"));
+    SASSERT(to_string(0) == make_string("0"));
+    SASSERT(to_string(9) == make_string("9"));
+    SASSERT(to_string(10) == make_string("10"));
+    SASSERT(to_string(-100) == make_string("-100"));
+    SASSERT(to_string(12345u) == make_string("12345"));
+    SASSERT(to_string(std::numeric_limits<int>::max()) == make_string("2147483647"));
+    SASSERT(to_string(-999999999999999999ll) == make_string("-999999999999999999"));
+    SASSERT(to_string(std::numeric_limits<int>::min()) == "-2147483648");
+    SASSERT(to_string(std::numeric_limits<long long>::min()) == "-9223372036854775808");
+    SASSERT(to_string(std::numeric_limits<signed char>::min()) == "-128");
+    SASSERT(to_string(std::numeric_limits<short>::min()) == "-32768");
+    SASSERT(to_string(-1000000000) == "-1000000000");
+    SASSERT(to_string(-1000000000000000000ll) == "-1000000000000000000");
+    check_signed<signed char>();
+    check_signed<short>();
+    check_billion<int>();
+    check_billion<long>();
+    check_billion<long long>();
+    SASSERT(to_string(std::numeric_limits<unsigned long long>::max()) == make_string("18446744073709551615"));
+    SASSERT(to_wstring(-42) == make_string(L"-42"));
+    SASSERT(detail::digits10_of(0) == 1);
+    SASSERT(detail::digits10_of(99999) == 5);
+    SASSERT(detail::digits10_of(-100000) == 6);
+    SASSERT(detail::digits10_of(std::numeric_limits<unsigned long long>::max()) == 20);
+    SASSERT(detail::digits10_at(12345, 0) == 5);
+    SASSERT(detail::digits10_at(12345, 4) == 1);
+    {
+        volatile long long n = -1234567890123ll;
+        assert(to_string(n).to_std_string() == std::to_string(n));
+        for(long long i = -100000; i <= 100000; i += 7){
+            assert(to_string(i).to_std_string() == std::to_string(i));
+        }
+    }
 
     SASSERT(detail::digits10_of(100.123) == 11);
     SASSERT(detail::digits10_of(0.123) == 9);
@@ -54,6 +114,51 @@ int main()
     SASSERT(to_u32string(-1.2345678e10) == make_string(U"-12345678000"));
     SASSERT(to_u32string(0.0) == make_string(U"0"));
 
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+    // shortest round-trip representation
+    SASSERT(to_string(0.1) == make_string("0.1"));
+    SASSERT(to_string(0.3) == make_string("0.3"));
+    SASSERT(to_string(1.0/3) == make_string("0.3333333333333333"));
+    SASSERT(to_string(0.001) == make_string("0.001"));
+    SASSERT(to_string(1e-5) == make_string("1e-05"));
+    SASSERT(to_string(1e21) == make_string("1e+21"));
+    SASSERT(to_string(1e23) == make_string("1e+23"));
+    SASSERT(to_string(9007199254740992.0) == make_string("9007199254740992"));
+    SASSERT(to_string(5e-324) == make_string("5e-324"));
+    SASSERT(to_string(-1.7976931348623157e308) == make_string("-1.7976931348623157e+308"));
+    SASSERT(to_string(0.1f) == make_string("0.1"));
+    SASSERT(to_string(3.4028235e38f) == make_string("3.4028235e+38"));
+#if defined FROZEN_HAS_BUILTIN_SIGNBIT || defined __cpp_lib_bit_cast
+    SASSERT(to_string(-0.0) == make_string("-0"));
+    SASSERT(to_string(-0.0f) == make_string("-0"));
+    SASSERT(to_string(-std::numeric_limits<double>::quiet_NaN()) == make_string("-nan"));
+#endif
+    SASSERT(to_string(0.0) == make_string("0"));
+    SASSERT(to_string(std::numeric_limits<double>::infinity()) == make_string("inf"));
+    SASSERT(to_string(-std::numeric_limits<double>::infinity()) == make_string("-inf"));
+    SASSERT(to_string(std::numeric_limits<double>::quiet_NaN()) == make_string("nan"));
+
+    // tight bounds instead of float_max_digits10
+    SASSERT(decltype(to_string(0.0))::len == 25);
+    SASSERT(decltype(to_string(0.0f))::len == 16);
+
+    {
+        double const values[] = { 0.1, 123.45, 1e-7, 6.02214076e23, 2.2250738585072014e-308, 1.0/3 };
+        for(double v : values){
+            assert(std::stod(to_string(v).to_std_string()) == v);
+        }
+        volatile double negative_zero = -0.0;
+        assert(to_string(negative_zero) == "-0");
+        volatile double negative_nan = -std::numeric_limits<double>::quiet_NaN();
+        assert(to_string(negative_nan) == "-nan");
+        assert(std::signbit(std::stod(to_string(negative_zero).to_std_string())));
+        volatile double v = 123.45;
+        assert(to_string(v) == to_string(123.45));
+        volatile float f = 0.1f;
+        assert(to_string(f) == to_string(0.1f));
+    }
+#endif
+
     assert(make_string("aiueo kakiku").to_std_string() == std::string("aiueo kakiku"));
     assert(make_string(L"aiueo kakiku").to_std_string() == std::wstring(L"aiueo kakiku"));
     assert(make_string(u"aiueo kakiku").to_std_string() == std::u16string(u"aiueo kakiku"));
@@ -1,7 +1,7 @@
 #include "../../frozen/string.hpp"
 #include "../util.hpp"
 
-constexpr frozen::string<10>
+constexpr frozen::string<11>
 fizzbuzz_value(int i)
 {
     return i % 15 == 0 ? "fizzbuzz" :
@@ -11,7 +11,7 @@ fizzbuzz_value(int i)
 }
 
 template<unsigned int I>
-constexpr frozen::string<I*11+1>
+constexpr frozen::string<I*12+1>
 fizzbuzz()
 {
     return fizzbuzz<I-1>() + fizzbuzz_value(I) + '\n';
@@ -0,0 +1,108 @@
+#include <string>
+#include <cassert>
+#include <limits>
+#include <system_error>
+
+#include "../util.hpp"
+
+#include "../../frozen/string.hpp"
+
+using namespace frozen;
+
+int main()
+{
+    // integers
+    SASSERT(to_integer<int>("42").value == 42);
+    SASSERT(to_integer<int>("-42").value == -42);
+    SASSERT(to_integer<int>("0042abc").value == 42);
+    SASSERT(to_integer<int>("0042abc").pos == 4);
+    SASSERT(to_integer<int>(make_string("123")).value == 123);
+    SASSERT(to_integer<int>(L"-7").value == -7);
+    SASSERT(to_integer<unsigned>("ff", 16).value == 255);
+    SASSERT(to_integer<unsigned>("FF", 16).value == 255);
+    SASSERT(to_integer<unsigned>("z", 36).value == 35);
+    SASSERT(to_integer<unsigned>("1012", 2).value == 5);
+    SASSERT(to_integer<unsigned>("1012", 2).pos == 3);
+    SASSERT(to_integer<int>("2147483647").value == std::numeric_limits<int>::max());
+    SASSERT(to_integer<int>("-2147483648").value == std::numeric_limits<int>::min());
+    SASSERT(to_integer<unsigned long long>("18446744073709551615").value == std::numeric_limits<unsigned long long>::max());
+    SASSERT(to_integer<int>("0000000000000000000000000000000000000001").value == 1);
+    SASSERT(to_integer<int>("42"));
+
+    // errors
+    SASSERT(to_integer<int>("2147483648").ec == std::errc::result_out_of_range);
+    SASSERT(to_integer<int>("2147483648").pos == 10);
+    SASSERT(to_integer<int>("-2147483649").ec == std::errc::result_out_of_range);
+    SASSERT(to_integer<unsigned char>("256").ec == std::errc::result_out_of_range);
+    SASSERT(to_integer<unsigned long long>("18446744073709551616").ec == std::errc::result_out_of_range);
+    SASSERT(to_integer<int>("99999999999999999999999999").ec == std::errc::result_out_of_range);
+    SASSERT(to_integer<unsigned>("-1").ec == std::errc::invalid_argument);
+    SASSERT(to_integer<int>("+1").ec == std::errc::invalid_argument);
+    SASSERT(to_integer<int>("").ec == std::errc::invalid_argument);
+    SASSERT(to_integer<int>("-").ec == std::errc::invalid_argument);
+    SASSERT(to_integer<int>("-").pos == 0);
+    SASSERT_NOT(to_integer<int>("x"));
+
+    // the runtime path gives the same results
+    {
+        std::string const inputs[] = { "0", "-0", "7", "12345678", "123456789012", "-9223372036854775808",
+                                        "9223372036854775808", "00000000000000000000000000123x", "1234567890123456789012" };
+        for(std::string const& s : inputs){
+            parse_result<long long> const r = detail::to_integer<long long>(s.data(), s.size(), 10);
+            parse_result<long long> const c = detail::to_integer_constexpr<long long>(s.data(), s.size(), 10, s[0] == '-');
+            assert(r.value == c.value && r.pos == c.pos && r.ec == c.ec);
+        }
+        for(long long i = -100000; i <= 100000; i += 7){
+            std::string const s = std::to_string(i * 1000003);
+            assert(detail::to_integer<long long>(s.data(), s.size(), 10).value == i * 1000003);
+        }
+    }
+
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+    // floating point numbers
+    SASSERT(to_floating<double>("1.5").value == 1.5);
+    SASSERT(to_floating<double>("-1.5e3").value == -1500.0);
+    SASSERT(to_floating<double>("0.1").value == 0.1);
+    SASSERT(to_floating<float>("0.1").value == 0.1f);
+    SASSERT(to_floating<double>(".5").value == 0.5);
+    SASSERT(to_floating<double>("5.").pos == 2);
+    SASSERT(to_floating<double>("12e3x").value == 12e3);
+    SASSERT(to_floating<double>("12e3x").pos == 4);
+    SASSERT(to_floating<double>("1e+").value == 1.0);
+    SASSERT(to_floating<double>("1e+").pos == 1);
+    SASSERT(to_floating<double>(make_string("2.5")).value == 2.5);
+    SASSERT(to_floating<double>("9007199254740993").value == 9007199254740992.0);
+    SASSERT(to_floating<double>("9007199254740993.0000000000000000000000001").value == 9007199254740994.0);
+    SASSERT(to_floating<double>("1.7976931348623157e308").value == std::numeric_limits<double>::max());
+    SASSERT(to_floating<double>("2.2250738585072014e-308").value == std::numeric_limits<double>::min());
+    SASSERT(to_floating<double>("4.9406564584124654e-324").value == std::numeric_limits<double>::denorm_min());
+    SASSERT(to_floating<double>("inf").value == std::numeric_limits<double>::infinity());
+    SASSERT(to_floating<double>("-Infinity").value == -std::numeric_limits<double>::infinity());
+    SASSERT(to_floating<double>("nan(123)").pos == 8);
+    SASSERT(to_floating<double>("nan").value != to_floating<double>("nan").value);
+
+    // errors
+    SASSERT(to_floating<double>("1e400").ec == std::errc::result_out_of_range);
+    SASSERT(to_floating<double>("1e-400").ec == std::errc::result_out_of_range);
+    SASSERT(to_floating<float>("1e39").ec == std::errc::result_out_of_range);
+    SASSERT(to_floating<double>("e5").ec == std::errc::invalid_argument);
+    SASSERT(to_floating<double>(".").ec == std::errc::invalid_argument);
+    SASSERT(to_floating<double>("+1").ec == std::errc::invalid_argument);
+
+    // round trip with to_string
+    SASSERT(to_floating<double>(to_string(0.1)).value == 0.1);
+    SASSERT(to_floating<double>(to_string(1.0/3)).value == 1.0/3);
+
+    {
+        std::string const inputs[] = { "0.1", "-123.456e-7", "1e23", "5e-300", "1.7976931348623158e308" };
+        for(std::string const& s : inputs){
+            double const v = std::stod(s);
+            assert(detail::to_floating<double>(s.data(), s.size()).value == v);
+            assert(detail::to_floating_constexpr<double>(s.data(), s.size()).value == v);
+        }
+    }
+#endif
+
+    std::cout << make_string("OK\n");
+    return 0;
+}
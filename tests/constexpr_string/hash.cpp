@@ -0,0 +1,54 @@
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <cassert>
+
+#include "../util.hpp"
+
+#include "../../frozen/string.hpp"
+
+using namespace frozen;
+
+int main()
+{
+    // FNV-1a test vectors
+    SASSERT(make_string("").hash() == 0xcbf29ce484222325ull);
+    SASSERT(make_string("a").hash() == 0xaf63dc4c8601ec8cull);
+    SASSERT(make_string("foobar").hash() == 0x85944171f73967e8ull);
+
+    SASSERT(make_string("hoge").hash() == make_string("hoge\0\0\0").hash());
+    SASSERT(string<16>("hoge").hash() == make_string("hoge").hash());
+    SASSERT((make_string("ho") + "ge").hash() == make_string("hoge").hash());
+    SASSERT(make_string("hoge").hash() != make_string("huga").hash());
+    SASSERT(make_string(L"hoge").hash() != make_string("hoge").hash());
+
+    // runtime gives the same value
+    std::string const runtime_src = "foobar";
+    string<16> const r = runtime_src.c_str();
+    assert(r.hash() == 0x85944171f73967e8ull);
+    wstring<16> const wr = std::wstring(L"hoge").c_str();
+    constexpr auto wh = make_string(L"hoge").hash();
+    assert(wr.hash() == wh);
+
+    std::unordered_set<string<16>> set = {"foo", "bar"};
+    assert(set.count("foo") == 1);
+    assert(set.count(r) == 0);
+
+    assert(string_hash{}(make_string("foobar")) == string_hash{}(runtime_src));
+    assert(string_equal{}(make_string("foobar"), runtime_src));
+    assert(!string_equal{}(make_string("foo"), runtime_src));
+
+#ifdef FROZEN_HAS_STRING_VIEW
+    SASSERT(string_hash{}(std::string_view{"foobar"}) == string_hash{}(make_string("foobar")));
+
+    std::unordered_map<string<16>, int, string_hash, string_equal> map = {{"foo", 1}, {"bar", 2}};
+    assert(map.find(make_string("bar"))->second == 2);
+#   if defined __cpp_lib_generic_unordered_lookup
+    assert(map.find(std::string_view{"foo"})->second == 1);
+    assert(map.find(std::string_view{"baz"}) == map.end());
+#   endif
+#endif
+
+    std::cout << make_string("OK\n");
+    return 0;
+}
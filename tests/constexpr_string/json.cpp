@@ -0,0 +1,88 @@
+#include <string>
+#include <cassert>
+#include <limits>
+
+#include "../util.hpp"
+
+#include "../../frozen/string.hpp"
+
+using namespace frozen;
+
+// a payload built once, at namespace scope
+constexpr auto capabilities = FROZEN_SHRINK(json::object(
+    json::member("name", make_string("frozen")),
+    json::member("streaming", false),
+    json::member("formats", json::array("json", "csv"))));
+
+int main()
+{
+    SASSERT(capabilities == "{\"name\":\"frozen\",\"streaming\":false,\"formats\":[\"json\",\"csv\"]}");
+    IS_SAME(decltype(capabilities), string<capabilities.size() + 1> const);
+
+    constexpr string<16> name = "frozen";
+
+    // scalars
+    SASSERT(json::array() == "[]");
+    SASSERT(json::object() == "{}");
+    SASSERT(json::array(1, -42, 0ull) == "[1,-42,0]");
+    SASSERT(json::array(true, false) == "[true,false]");
+    SASSERT(json::object(
+                json::member("int", std::numeric_limits<int>::min()),
+                json::member("long long", std::numeric_limits<long long>::min()),
+                json::member("signed char", static_cast<signed char>(-128)))
+            == "{\"int\":-2147483648,\"long long\":-9223372036854775808,\"signed char\":-128}");
+    SASSERT(json::array(0.5, -2.25) == "[0.5,-2.25]");
+    SASSERT(json::array("a", 'b', name) == "[\"a\",\"b\",\"frozen\"]");
+    SASSERT(json::array("") == "[\"\"]");
+
+    // escaping
+    SASSERT(json::array("say \"hi\"") == "[\"say \\\"hi\\\"\"]");
+    SASSERT(json::array("C:\\tmp") == "[\"C:\\\\tmp\"]");
+    SASSERT(json::array("a\tb\nc\rd\be\ff") == "[\"a\\tb\\nc\\rd\\be\\ff\"]");
+    SASSERT(json::array("\x01\x1f") == "[\"\\u0001\\u001f\"]");
+    SASSERT(json::array("\xc3\xa9/") == "[\"\xc3\xa9/\"]");
+    SASSERT(json::object(json::member("\"k\"", 1)) == "{\"\\\"k\\\"\":1}");
+
+    // objects and nesting
+    constexpr auto health = json::object(
+        json::member("status", "ok"),
+        json::member("version", name),
+        json::member("uptime", 42),
+        json::member("checks", json::array(json::object(json::member("db", true)), json::array())),
+        json::member("load", 0.75));
+    SASSERT(health == "{\"status\":\"ok\",\"version\":\"frozen\",\"uptime\":42,"
+                      "\"checks\":[{\"db\":true},[]],\"load\":0.75}");
+
+    // the exact capacity
+    constexpr auto exact = FROZEN_SHRINK(health);
+    SASSERT(exact == health);
+    IS_SAME(decltype(exact), string<health.size() + 1> const);
+    constexpr auto small = FROZEN_SHRINK(json::object(
+        json::member("status", "ok"),
+        json::member("checks", json::array(1, 2.5, true))));
+    SASSERT(small == "{\"status\":\"ok\",\"checks\":[1,2.5,true]}");
+    IS_SAME(decltype(small), string<38> const);
+
+    // wide strings
+    SASSERT(json::object(json::member(L"k", L"\u00e9\"")) == L"{\"k\":\"\u00e9\\\"\"}");
+    SASSERT(json::basic_array<char16_t>(1, true) == u"[1,true]");
+    SASSERT(json::object(json::member(U"n", json::basic_array<char32_t>(1, 2))) == U"{\"n\":[1,2]}");
+
+    // at runtime
+    auto const s = json::object(json::member("k", std::string("v\n").c_str()[0] == 'v'));
+    assert(s.to_std_string() == "{\"k\":true}");
+    assert(json::array(make_string("x\"y")).to_std_string() == "[\"x\\\"y\"]");
+
+    bool thrown = false;
+    try{
+        double const zero = std::string("0").size() - 1.0;
+        static_cast<void>(json::array(1.0 / zero));
+    }catch(std::domain_error const&){
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "OK" << std::endl;
+
+    return 0;
+}
@@ -15,6 +15,18 @@ int main()
     SASSERT(u"ｲﾇｩ…"_fstr == make_string(u"ｲﾇｩ…"));
     SASSERT(U"＾ω＾"_fstr == make_string(U"＾ω＾"));
 
+#if defined FROZEN_HAS_CLASS_TYPE_NTTP || defined FROZEN_HAS_GNU_STRING_LITERAL_OPERATOR_TEMPLATE
+    IS_SAME(decltype("aiueo"_fstr), basic_string<char, 6>);
+    IS_SAME(decltype(""_fstr), basic_string<char, 1>);
+    IS_SAME(decltype(U"＾ω＾"_fstr), basic_string<char32_t, 4>);
+    IS_SAME(decltype("ok"_fstr + "ng"_fstr), basic_string<char, 6>);
+    SASSERT("ok"_fstr + "ng"_fstr == "okng");
+    SASSERT(""_fstr.empty());
+    SASSERT("ok"_fstr.size() == 2);
+#else
+    IS_SAME(decltype("aiueo"_fstr), basic_string<char, FROZEN_STRING_LITERALS_MAX_LENGTH>);
+#endif
+
     SASSERT('_'_fstr == make_string("_"));
     SASSERT(L'-'_fstr == make_string(L"-"));
     SASSERT(u'ω'_fstr == make_string(u"ω"));
@@ -0,0 +1,57 @@
+#include <string>
+#include <cassert>
+
+#include "../util.hpp"
+
+#include "../../frozen/string.hpp"
+
+using namespace frozen;
+
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+
+// relaxed constexpr evaluates with loops, so the length of a string is
+// bounded by the memory of the compiler rather than by its recursion depth
+#define X16 "abcdefghijklmnop"
+#define X64 X16 X16 X16 X16
+#define X256 X64 X64 X64 X64
+#define X1024 X256 X256 X256 X256
+#define X4096 X1024 X1024 X1024 X1024
+#define X8192 X4096 X4096
+#define X16384 X8192 X8192
+
+constexpr auto s = make_string(X16384);
+constexpr auto half = make_string(X8192);
+constexpr basic_string<char, 16385> copied = half;
+
+#endif
+
+int main()
+{
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+    SASSERT(s.size() == 16384);
+    SASSERT(s == X16384);
+    SASSERT(s != X8192);
+    SASSERT(half < s);
+    SASSERT(!(s < half + half));
+    SASSERT(half + half == s);
+    SASSERT(concat(half, half) == s);
+    SASSERT(copied == half);
+    SASSERT(FROZEN_SHRINK(half + half).max_size() == 16385);
+    SASSERT((s + '!').size() == 16385);
+    SASSERT(s.hash() == (half + half).hash());
+    SASSERT(s.find("pa") == 15);
+    SASSERT(s.find("pa", 16000) == 16015);
+    SASSERT(s.rfind("ab") == 16368);
+    SASSERT(s.find_first_not_of("abcdefghijklmnop") == s.npos);
+    SASSERT(s.ends_with("op"));
+
+    // runtime
+    std::string const x16384 = X16384;
+    assert(s.to_std_string() == x16384);
+    assert(s.find(x16384.back()) == 15);
+    assert(s.rfind(x16384.front()) == 16368);
+#endif
+
+    std::cout << make_string("OK\n");
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <string>
+#include <cassert>
+
+#include "../util.hpp"
+
+#include "../../frozen/string.hpp"
+
+using namespace frozen;
+
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+
+constexpr map<string<16>, int, 7> methods = {
+    {"GET", 1}, {"HEAD", 2}, {"POST", 3}, {"PUT", 4},
+    {"DELETE", 5}, {"OPTIONS", 6}, {"PATCH", 7},
+};
+
+constexpr set<string<16>, 4> verbs = {"GET", "POST", "PUT", "DELETE"};
+
+// enough keys to exercise multi-key buckets
+#define K(n) make_string("key_" #n)
+constexpr set<string<16>, 40> many = {
+    K(0), K(1), K(2), K(3), K(4), K(5), K(6), K(7), K(8), K(9),
+    K(10), K(11), K(12), K(13), K(14), K(15), K(16), K(17), K(18), K(19),
+    K(20), K(21), K(22), K(23), K(24), K(25), K(26), K(27), K(28), K(29),
+    K(30), K(31), K(32), K(33), K(34), K(35), K(36), K(37), K(38), K(39),
+};
+#undef K
+
+#endif
+
+int main()
+{
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+    SASSERT(methods.size() == 7);
+    SASSERT(methods.at("GET") == 1);
+    SASSERT(methods.at("PATCH") == 7);
+    SASSERT(methods.at(make_string("OPTIONS")) == 6);
+    SASSERT(methods.count("TRACE") == 0);
+    SASSERT(methods.find("GE") == methods.end());
+    SASSERT(methods.find("DELETE")->first == "DELETE");
+    SASSERT(methods.begin()->first == "GET");
+
+    SASSERT(verbs.contains("PUT"));
+    SASSERT(!verbs.contains("HEAD"));
+    SASSERT(!verbs.contains(""));
+
+    SASSERT(many.contains("key_0"));
+    SASSERT(many.contains("key_39"));
+    SASSERT(!many.contains("key_40"));
+
+    // runtime lookup
+    std::string const post = "POST";
+    assert(methods.at(post) == 3);
+    assert(methods.count(std::string("CONNECT")) == 0);
+    for(auto const& k : many){
+        assert(many.find(k.to_std_string()) == &k);
+    }
+    bool thrown = false;
+    try{
+        methods.at(std::string("TRACE"));
+    }catch(std::out_of_range const&){
+        thrown = true;
+    }
+    assert(thrown);
+#endif
+
+    std::cout << make_string("OK\n");
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <string>
+#include <cassert>
+#include <vector>
+#include <utility>
+
+#include "../util.hpp"
+
+#include "../../frozen/string.hpp"
+
+using namespace frozen;
+
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+
+#ifdef FROZEN_HAS_AUTO_NTTP
+static constexpr auto error = make_string("ERROR");
+static constexpr auto warn = make_string("WARN");
+#endif
+
+int main()
+{
+    constexpr auto m = make_multi_matcher("he", "she", "his", "hers");
+    SASSERT(m.size() == 4);
+    SASSERT(m.find("ushers").pattern == 1);
+    SASSERT(m.find("ushers").position == 1);
+    SASSERT(m.find("ushers", 2).pattern == 0);
+    SASSERT(m.find("ushers", 2).position == 2);
+    SASSERT(m.find("this").pattern == 2);
+    SASSERT(!m.find("xyz"));
+    SASSERT(m.find("xyz").position == m.npos);
+    SASSERT(m.count("ushers") == 3);
+    SASSERT(m.contains_any(make_string("shore")) == false);
+    SASSERT(m.contains_any(make_string("heresy")));
+
+    // the types of the pattern sources can be mixed
+    constexpr auto levels = make_multi_matcher(make_string("ERROR"), "WARN", meta::basic_string<char, 't', 'i', 'm', 'e', 'o', 'u', 't'>{});
+    SASSERT(levels.find("[12:00] WARN disk").pattern == 1);
+    SASSERT(levels.find("[12:00] WARN disk").position == 8);
+    SASSERT(levels.find("connection timeout").pattern == 2);
+    SASSERT(!levels.find("INFO ok"));
+
+    // compressed alphabet: 'A', 'E', 'N', 'O', 'R', 'W', 'e', 'i', 'm', 'o', 't', 'u' and the rest
+    SASSERT(levels.column('A') == 0);
+    SASSERT(levels.column('u') == 11);
+    SASSERT(levels.column('x') == levels.column('!'));
+
+    constexpr auto wide = make_multi_matcher(L"エラー", L"警告");
+    SASSERT(wide.find(L"ディスク警告").pattern == 1);
+    SASSERT(wide.find(L"ディスク警告").position == 4);
+
+#ifdef FROZEN_HAS_AUTO_NTTP
+    SASSERT(static_multi_matcher<error, warn>.find("WARN: ERROR").pattern == 1);
+#endif
+
+    // every occurrence in a single pass, compared with std::string::find
+    {
+        std::string text;
+        for(int i = 0; i < 200; ++i){
+            text += i % 7 == 0 ? "ERROR timeout " : i % 3 == 0 ? "WARN disk " : "INFO ok ";
+        }
+        std::vector<std::pair<size_t, size_t>> found;
+        levels.for_each(text, [&](decltype(levels)::match r){ found.emplace_back(r.pattern, r.position); });
+
+        std::vector<std::pair<size_t, size_t>> expected;
+        std::string const patterns[] = { "ERROR", "WARN", "timeout" };
+        for(size_t end = 1; end <= text.size(); ++end){
+            for(size_t p = 0; p < 3; ++p){
+                size_t const n = patterns[p].size();
+                if(n <= end && text.compare(end - n, n, patterns[p]) == 0){
+                    expected.emplace_back(p, end - n);
+                }
+            }
+        }
+        assert(found == expected);
+        assert(levels.count(text) == expected.size());
+    }
+
+    std::cout << make_string("OK\n");
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::cout << make_string("OK\n");
+    return 0;
+}
+
+#endif
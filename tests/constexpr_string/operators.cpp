@@ -8,6 +8,16 @@
 
 using namespace frozen;
 
+#if defined FROZEN_HAS_AUTO_NTTP
+static constexpr auto wide = make_string("ab") + 12345 + 3.5;
+#endif
+
+// GCC rejects comparing the address of a temporary operand with nullptr
+// in a template argument at namespace scope
+static constexpr auto answer = FROZEN_SHRINK(concat(make_string("answer: "), 42, '!'));
+SASSERT(answer == "answer: 42!");
+IS_SAME(decltype(answer), string<12> const);
+
 int main()
 {
     constexpr string<4> arr[] = {"a", "bb", "ccc"};
@@ -69,6 +79,18 @@ int main()
     SASSERT("aaba" > make_string("aab\0\0"));
     SASSERT_NOT(make_string("\0") > make_string(""));
 
+    // not constant-evaluated
+    std::string const runtime_src = "aiueokakikukekosashisuseso";
+    string<32> const r1 = runtime_src.c_str();
+    assert(r1 == "aiueokakikukekosashisuseso");
+    assert(r1 == make_string("aiueokakikukekosashisuseso"));
+    assert(r1 != "aiueokakikukekosashisusesa");
+    assert(r1 < "aiueokakikukekosashisusesp");
+    assert(r1 < make_string("aiueokakikukekosashisuseso!"));
+    assert(r1 > "aiueokakikukekosashisusesn");
+    assert(r1 > make_string("aiueo"));
+    assert(!(r1 < r1) && !(r1 > r1));
+
     constexpr auto s4 = s3;
     SASSERT(s4 == s3);
 
@@ -79,6 +101,12 @@ int main()
     SASSERT(make_string("aaaa\0\0\0").size() == 4);
     SASSERT(make_string("").size() == 0);
     SASSERT(string<5>{{{'p', 'o', 'y', 'o'}}}.size() == 4);
+    SASSERT((make_string("aa\0\0") + "bbb").size() == 5);
+    SASSERT(('_' + make_string("poyo\0\0")).size() == 5);
+    SASSERT((empty_str + '{').size() == 1);
+    SASSERT(empty_str + '{' == "{");
+    SASSERT(make_string("").empty());
+    SASSERT_NOT(make_string("a\0").empty());
 
     SASSERT(make_string("aa\0\0\0\0\0\0") + "bb" == "aabb");
     SASSERT("aabb" == make_string("aa\0\0\0\0\0\0") + "bb");
@@ -113,6 +141,36 @@ int main()
                   '}';
     SASSERT(json == "{\"random_tree_depth\" : 4,\"population_size\" : 100,\"mutation_percent\" : 5,\"crossover_percent\" : 50,}");
 
+    auto constexpr concat_json = concat(
+                  '{',
+                      "\"random_tree_depth\" : ", random_tree_depth, ',',
+                      "\"population_size\" : ", population_size, ',',
+                      "\"mutation_percent\" : ", mutation_percent, ',',
+                      "\"crossover_percent\" : ", crossover_percent, ',',
+                  '}');
+    SASSERT(concat_json == json);
+    SASSERT(concat_json.max_size() < json.max_size());
+
+    SASSERT(concat(make_string("Today is "), 8, '/', 5) == "Today is 8/5");
+    SASSERT(concat("ab", "cd") == "abcd");
+    IS_SAME(decltype(concat("ab", "cd")), string<5>);
+    SASSERT(concat(make_string(L"poyo\0\0"), L'_', -42) == L"poyo_-42");
+    SASSERT(concat(3.14159, " is pi") == "3.14159 is pi");
+    SASSERT(concat() == "");
+    SASSERT(concat("a", "", 'b').size() == 2);
+
+    auto constexpr shrunk_json = FROZEN_SHRINK(json);
+    SASSERT(shrunk_json == json);
+    IS_SAME(decltype(shrunk_json), string<json.size()+1> const);
+    SASSERT(sizeof(shrunk_json) < sizeof(json));
+    SASSERT(shrink_to<16>(make_string("hoge")) == "hoge");
+    SASSERT(shrink_to<16>(make_string("hoge")).size() == 4);
+    SASSERT(shrink_to<1>(make_string("")) == "");
+#if defined FROZEN_HAS_AUTO_NTTP
+    IS_SAME(decltype(shrink<wide>()), string<11>);
+    SASSERT(shrink<wide>() == "ab123453.5");
+#endif
+
     std::cout << make_string("OK\n");
     return 0;
 }
@@ -0,0 +1,112 @@
+#include <string>
+#include <cassert>
+#include <regex>
+
+#include "../util.hpp"
+
+#include "../../frozen/string.hpp"
+
+using namespace frozen;
+
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+
+// (a|b)*abb, the example of the dragon book
+typedef regex<meta::basic_string<char, '(', 'a', '|', 'b', ')', '*', 'a', 'b', 'b'>> abb;
+
+// [0-9]+(\.[0-9]*)?
+typedef regex<meta::basic_string<char, '[', '0', '-', '9', ']', '+', '(', '\\', '.', '[', '0', '-', '9', ']', '*', ')', '?'>> number;
+
+// ^x{2,3}$
+typedef regex<meta::basic_string<char, '^', 'x', '{', '2', ',', '3', '}', '$'>> xx;
+
+// [^é]+ in wide characters
+typedef regex<meta::basic_string<wchar_t, L'[', L'^', L'é', L']', L'+'>> not_e;
+
+#ifdef FROZEN_HAS_AUTO_NTTP
+static constexpr auto date = make_string("\\d{4}-\\d{2}-\\d{2}");
+static constexpr auto method = make_string("^(GET|POST|PUT|DELETE) /\\S*");
+static constexpr auto ident = make_string("[A-Za-z_]\\w*");
+static constexpr auto abcd_or_c = make_string("abcd|c");
+static constexpr auto a_then_b = make_string("a.*b");
+// the unanchored DFA would need more states than the limit
+static constexpr auto a_then_8 = make_string("a[ab]{8}");
+#endif
+
+int main()
+{
+    SASSERT(abb::match("abb"));
+    SASSERT(abb::match("ababaabb"));
+    SASSERT_NOT(abb::match("abba"));
+    SASSERT_NOT(abb::match(""));
+    // the minimal DFA has four states besides the dead one, over {a}, {b} and the rest
+    SASSERT(abb::state_count() == 5);
+    SASSERT(abb::class_count() == 3);
+
+    SASSERT(abb::search("xxabbb").position == 2);
+    SASSERT(abb::search("xxabbb").length == 3);
+    SASSERT(abb::search("xxabbb", 3).position == abb::npos);
+    SASSERT_NOT(abb::search("ab"));
+
+    // the longest match
+    SASSERT(number::search("pi is 3.14.").position == 6);
+    SASSERT(number::search("pi is 3.14.").length == 4);
+    SASSERT(number::match(make_string("42.")));
+    SASSERT_NOT(number::match(make_string(".5")));
+
+    // anchors
+    SASSERT(xx::match("xxx"));
+    SASSERT_NOT(xx::match("xxxx"));
+    SASSERT(xx::search("xx").length == 2);
+    SASSERT_NOT(xx::search("axx"));
+    SASSERT_NOT(xx::search("xxa"));
+
+    SASSERT(not_e::match(L"cafe"));
+    SASSERT_NOT(not_e::match(L"café"));
+    SASSERT(not_e::search(L"éte").position == 1);
+
+    assert(abb::match(std::string("babb")));
+    assert(number::search(std::string("v2.0 released")).length == 3);
+
+#ifdef FROZEN_HAS_AUTO_NTTP
+    SASSERT(static_regex<date>.match("2024-02-29"));
+    SASSERT_NOT(static_regex<date>.match("2024-2-29"));
+    SASSERT(static_regex<date>.search("due 2024-02-29.").position == 4);
+    SASSERT(static_regex<method>.search("POST /api/v1 HTTP/1.1").length == 12);
+    SASSERT_NOT(static_regex<method>.search(" GET /"));
+
+    // the leftmost match ends after the first match to end
+    SASSERT(static_regex<abcd_or_c>.search("xabcd").position == 1);
+    SASSERT(static_regex<abcd_or_c>.search("xabcd").length == 4);
+    SASSERT(static_regex<a_then_b>.search("xaab").length == 3);
+    SASSERT(static_regex<a_then_8>.search("bbababababa").position == 2);
+    SASSERT_NOT(static_regex<a_then_8>.search("bbababab"));
+    assert(!static_regex<a_then_b>.search(std::string(1000000, 'a')));
+
+    // the same answers as std::regex
+    {
+        std::regex const re("[A-Za-z_]\\w*");
+        std::string const words[] = { "", "_", "a1", "1a", "snake_case", "kebab-case", "x y", "Z9_" };
+        for(auto const& w : words){
+            assert(static_regex<ident>.match(w) == std::regex_match(w, re));
+            std::smatch m;
+            bool const found = std::regex_search(w, m, re);
+            auto const r = static_regex<ident>.search(w);
+            assert(static_cast<bool>(r) == found);
+            assert(!found || (r.position == static_cast<size_t>(m.position(0)) && r.length == static_cast<size_t>(m.length(0))));
+        }
+    }
+#endif
+
+    std::cout << make_string("OK\n");
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::cout << make_string("OK\n");
+    return 0;
+}
+
+#endif
@@ -0,0 +1,81 @@
+#include <string>
+#include <cassert>
+
+#include "../util.hpp"
+
+#include "../../frozen/string.hpp"
+
+using namespace frozen;
+
+int main()
+{
+    constexpr auto s = make_string("hello, frozen world");
+    constexpr string<32> padded = "abcabc";
+
+    SASSERT(s.find("o") == 4);
+    SASSERT(s.find('o') == 4);
+    SASSERT(s.find("o", 5) == 9);
+    SASSERT(s.find(make_string("world")) == 14);
+    SASSERT(s.find("worlds") == s.npos);
+    SASSERT(s.find("") == 0);
+    SASSERT(s.find("", 19) == 19);
+    SASSERT(s.find("", 20) == s.npos);
+    SASSERT(padded.find('\0') == string<32>::npos);
+    SASSERT(padded.find("abc", 1) == 3);
+
+    SASSERT(s.rfind('o') == 15);
+    SASSERT(s.rfind("o", 14) == 9);
+    SASSERT(s.rfind("hello") == 0);
+    SASSERT(s.rfind("") == 19);
+    SASSERT(padded.rfind("abc") == 3);
+    SASSERT(padded.rfind("abc", 2) == 0);
+
+    SASSERT(s.find_first_of(", ") == 5);
+    SASSERT(s.find_first_of("xyz") == 10);
+    SASSERT(s.find_first_of("q") == s.npos);
+    SASSERT(s.find_first_not_of("leho") == 5);
+    SASSERT(s.find_last_of("lo") == 17);
+    SASSERT(s.find_last_not_of("dlrow") == 13);
+    SASSERT(s.find_last_not_of('d') == 17);
+    SASSERT(make_string("aaa").find_last_not_of('a') == string<4>::npos);
+    SASSERT(make_string("").find_last_not_of('a') == string<1>::npos);
+
+    SASSERT(s.starts_with("hello"));
+    SASSERT(s.starts_with('h'));
+    SASSERT_NOT(s.starts_with("hello, frozen world!"));
+    SASSERT(s.ends_with(make_string("world")));
+    SASSERT(s.ends_with('d'));
+    SASSERT_NOT(s.ends_with("hello"));
+    SASSERT(s.contains("frozen"));
+    SASSERT(s.contains(','));
+    SASSERT_NOT(s.contains("cold"));
+
+    SASSERT(make_string(L"あいうえお").find(L"うえ") == 2);
+    SASSERT(make_string(u"あいうえお").find_first_of(u'お') == 4);
+
+    // runtime results are the same as std::string
+    {
+        string<64> const hay = "abracadabra, abracadabra! cadabra";
+        std::string const std_hay = hay.to_std_string();
+        char const* const needles[] = { "a", "abra", "cad", "ra,", "", "zz", "abracadabra, abracadabra! cadabra!", ", !" };
+        for(char const* n : needles){
+            std::string const needle = n;
+            for(size_t pos = 0; pos <= std_hay.size() + 1; ++pos){
+                assert(detail::find(hay.data(), hay.size(), n, needle.size(), pos) == std_hay.find(needle, pos));
+                assert(detail::rfind(hay.data(), hay.size(), n, needle.size(), pos) == std_hay.rfind(needle, pos));
+                assert(detail::find_first_of(hay.data(), hay.size(), n, needle.size(), pos, true) == std_hay.find_first_of(needle, pos));
+                assert(detail::find_first_of(hay.data(), hay.size(), n, needle.size(), pos, false) == std_hay.find_first_not_of(needle, pos));
+                assert(detail::find_last_of(hay.data(), hay.size(), n, needle.size(), pos, true) == std_hay.find_last_of(needle, pos));
+                assert(detail::find_last_of(hay.data(), hay.size(), n, needle.size(), pos, false) == std_hay.find_last_not_of(needle, pos));
+            }
+        }
+        assert(hay.find("cadabra", 20) == 26);
+        assert(hay.rfind('!') == 24);
+        assert(hay.contains("abra!"));
+        assert(!hay.contains("abra?"));
+        assert(hay.ends_with("cadabra"));
+    }
+
+    std::cout << make_string("OK\n");
+    return 0;
+}
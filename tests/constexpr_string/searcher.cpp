@@ -0,0 +1,72 @@
+#include <string>
+#include <cassert>
+#include <algorithm>
+#include <vector>
+#include <functional>
+
+#include "../util.hpp"
+
+#include "../../frozen/string.hpp"
+
+using namespace frozen;
+
+#ifdef FROZEN_HAS_AUTO_NTTP
+static constexpr auto error_needle = make_string("ERROR");
+#endif
+
+int main()
+{
+    constexpr auto s = make_searcher(make_string("abcab"));
+    SASSERT(s.shift('a') == 1);
+    SASSERT(s.shift('b') == 3);
+    SASSERT(s.shift('c') == 2);
+    SASSERT(s.shift('x') == 5);
+    SASSERT(s.find("xxabcabyy") == 2);
+    SASSERT(s.find(make_string("abcaabcab")) == 4);
+    SASSERT(s.find("abcaa") == searcher<char, 6>::npos);
+    SASSERT(s.find("abcababcab", 1) == 5);
+    IS_SAME(searcher<char, 6>::shift_type, std::uint8_t);
+
+    constexpr auto w = make_searcher(L"ウェブ");
+    SASSERT(w.find(L"ハローウェブ") == 3);
+
+    constexpr auto empty = make_searcher("");
+    SASSERT(empty.find("abc") == 0);
+
+    // runtime: vectorized prefilter, then Horspool for the tail
+    {
+        std::string hay;
+        for(int i = 0; i < 500; ++i){
+            hay += "lorem ipsum dolor sit amet " + std::to_string(i) + ' ';
+        }
+        std::string const needles[] = { "am", "amet 42", "499 ", "sit amet 123 lorem ipsum dolor sit amet 124",
+                                        "not found", "lorem", "t 0 l" };
+        for(std::string const& n : needles){
+            string<64> const fn = n.c_str();
+            searcher<char, 64> const sr(fn);
+            for(size_t pos = 0; pos < hay.size(); pos += 97){
+                assert(sr.find(hay.data(), hay.size(), pos) == hay.find(n, pos));
+            }
+            assert(sr.find(hay) == hay.find(n));
+            // std::search with iterators and with pointers
+            auto const it = std::search(hay.begin(), hay.end(), n.begin(), n.end());
+            assert(sr(hay.begin(), hay.end()).first == it);
+            assert(sr(hay.data(), hay.data() + hay.size()).first == hay.data() + (it - hay.begin()));
+        }
+    }
+
+#ifdef FROZEN_HAS_STRING_VIEW
+    {
+        std::vector<char> const v = { 'x', 'E', 'R', 'R', 'O', 'R', '!' };
+        constexpr auto e = make_searcher("ERROR");
+        assert(std::search(v.begin(), v.end(), e) == v.begin() + 1);
+    }
+#endif
+
+#ifdef FROZEN_HAS_AUTO_NTTP
+    SASSERT(static_searcher<error_needle>.find("[ERROR] disk") == 1);
+#endif
+
+    std::cout << make_string("OK\n");
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <string>
+#include <cassert>
+
+#include "../util.hpp"
+
+#include "../../frozen/string.hpp"
+
+using namespace frozen;
+
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+
+constexpr sorted_set<string<16>, 7> methods = {
+    "PUT", "GET", "POST", "DELETE", "PATCH", "HEAD", "OPTIONS",
+};
+
+// keys longer than the inline prefix, which differ only after it
+constexpr sorted_set<string<24>, 5> paths = {
+    "/api/v1/users", "/api/v1/user", "/api/v2/users", "/api/v1/users/me", "/about",
+};
+
+// "\x80" is before "a" where char is signed, after "\x7f" where it is not
+constexpr sorted_set<string<4>, 4> bytes = {"\x80", "a", "", "\x7f"};
+
+constexpr sorted_set<u16string<8>, 3> wide = {u"ω", u"b", u"a"};
+
+// enough keys for a tree of several levels
+#define K(n) make_string("key_" #n)
+constexpr sorted_set<string<16>, 40> many = {
+    K(39), K(38), K(37), K(36), K(35), K(34), K(33), K(32), K(31), K(30),
+    K(29), K(28), K(27), K(26), K(25), K(24), K(23), K(22), K(21), K(20),
+    K(19), K(18), K(17), K(16), K(15), K(14), K(13), K(12), K(11), K(10),
+    K(9), K(8), K(7), K(6), K(5), K(4), K(3), K(2), K(1), K(0),
+};
+#undef K
+
+#endif
+
+int main()
+{
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+    // sorted
+    SASSERT(methods.size() == 7);
+    SASSERT(methods.begin()[0] == "DELETE");
+    SASSERT(methods.begin()[1] == "GET");
+    SASSERT(methods.begin()[6] == "PUT");
+
+    SASSERT(methods.contains("PATCH"));
+    SASSERT(!methods.contains("TRACE"));
+    SASSERT(!methods.contains("PO"));
+    SASSERT(!methods.contains(""));
+    SASSERT(methods.find("HEAD") == methods.begin() + 2);
+    SASSERT(methods.count("OPTIONS") == 1);
+
+    // range queries
+    SASSERT(*methods.lower_bound("H") == "HEAD");
+    SASSERT(*methods.lower_bound("HEAD") == "HEAD");
+    SASSERT(*methods.upper_bound("HEAD") == "OPTIONS");
+    SASSERT(methods.lower_bound("") == methods.begin());
+    SASSERT(methods.lower_bound("Z") == methods.end());
+    SASSERT(methods.upper_bound("PUT") == methods.end());
+    SASSERT(methods.equal_range("GET").second - methods.equal_range("GET").first == 1);
+    SASSERT(methods.equal_range("GE").second == methods.equal_range("GE").first);
+
+    // prefix queries
+    SASSERT(methods.prefix_range("P").first == methods.begin() + 4);
+    SASSERT(methods.prefix_range("P").second == methods.end());
+    SASSERT(methods.prefix_range("PO").second - methods.prefix_range("PO").first == 1);
+    SASSERT(methods.prefix_range("X").first == methods.prefix_range("X").second);
+    SASSERT(methods.prefix_range("").second - methods.prefix_range("").first == 7);
+
+    SASSERT(paths.begin()[0] == "/about");
+    SASSERT(paths.begin()[1] == "/api/v1/user");
+    SASSERT(paths.begin()[2] == "/api/v1/users");
+    SASSERT(paths.begin()[3] == "/api/v1/users/me");
+    SASSERT(paths.contains("/api/v1/users"));
+    SASSERT(!paths.contains("/api/v1/use"));
+    SASSERT(*paths.lower_bound("/api/v1/usera") == "/api/v1/users");
+    SASSERT(paths.prefix_range("/api/v1/").second - paths.prefix_range("/api/v1/").first == 3);
+
+    SASSERT(bytes.begin()[0] == "");
+    SASSERT(bytes.begin()[1] < bytes.begin()[2]);
+    SASSERT(bytes.begin()[2] < bytes.begin()[3]);
+    SASSERT(bytes.begin()[1] == (std::is_signed<char>::value ? make_string("\x80") : make_string("a")));
+    SASSERT(bytes.contains("\x80"));
+    SASSERT(bytes.contains(""));
+
+    SASSERT(wide.begin()[0] == u"a");
+    SASSERT(wide.begin()[2] == u"ω");
+    SASSERT(wide.contains(u"b"));
+
+    SASSERT(many.begin()[0] == "key_0");
+    SASSERT(many.begin()[1] == "key_1");
+    SASSERT(many.begin()[2] == "key_10");
+    SASSERT(many.contains("key_39"));
+    SASSERT(!many.contains("key_40"));
+
+    // runtime lookup
+    for(auto it = many.begin(); it != many.end(); ++it){
+        std::string const k = it->to_std_string();
+        assert(many.find(k) == it);
+        assert(many.lower_bound(k) == it);
+        assert(many.upper_bound(k) == it + 1);
+        if(it + 1 != many.end()){
+            assert(*it < *(it + 1));
+        }
+    }
+    assert(many.prefix_range(std::string("key_3")).second - many.prefix_range(std::string("key_3")).first == 11);
+    assert(!methods.contains(std::string("CONNECT")));
+
+    bool thrown = false;
+    try{
+        sorted_set<string<8>, 3> duplicates = {"GET", std::string("PUT").c_str(), "GET"};
+        static_cast<void>(duplicates);
+    }catch(std::invalid_argument const&){
+        thrown = true;
+    }
+    assert(thrown);
+#endif
+
+    std::cout << make_string("OK\n");
+    return 0;
+}
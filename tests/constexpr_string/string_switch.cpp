@@ -0,0 +1,120 @@
+#include <string>
+#include <cassert>
+
+#include "../util.hpp"
+
+#include "../../frozen/string.hpp"
+
+using namespace frozen;
+
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+
+typedef meta::basic_string<char, 'G', 'E', 'T'> get;
+typedef meta::basic_string<char, 'P', 'O', 'S', 'T'> post;
+typedef meta::basic_string<char, 'P', 'U', 'T'> put;
+typedef meta::basic_string<char, 'H', 'E', 'A', 'D'> head;
+typedef meta::basic_string<char, 'a', 'b'> ab;
+typedef meta::basic_string<char, 'a', 'c'> ac;
+typedef meta::basic_string<char, 'b', 'b'> bb;
+typedef meta::basic_string<char, 'b', 'c'> bc;
+typedef meta::basic_string<char> empty;
+
+struct value{
+    int v;
+
+    constexpr int operator()() const
+    {
+        return v;
+    }
+};
+
+template<class String>
+constexpr int method(String const& s)
+{
+    return string_switch(s,
+                         case_<get>(value{1}), case_<post>(value{2}), case_<put>(value{3}), case_<head>(value{4}),
+                         default_(value{0}));
+}
+
+template<class String>
+constexpr int pairs(String const& s)
+{
+    return string_switch(s,
+                         case_<ab>(value{1}), case_<ac>(value{2}), case_<bb>(value{3}), case_<bc>(value{4}), case_<empty>(value{5}),
+                         default_(value{0}));
+}
+
+struct half{
+    constexpr double operator()() const
+    {
+        return 0.5;
+    }
+};
+
+#ifdef FROZEN_HAS_AUTO_NTTP
+static constexpr auto error = make_string("ERROR");
+static constexpr auto warn = make_string("WARN");
+#endif
+
+int main()
+{
+    // GET and PUT have the same length, the first character tells them apart
+    SASSERT(detail::label_table<char, get, post, put, head>::key.strategy == detail::label_strategy::position);
+    SASSERT(detail::label_table<char, get, post, put, head>::key.position == 0);
+    SASSERT(detail::label_table<char, get, post>::key.strategy == detail::label_strategy::length);
+    SASSERT(detail::label_table<char, ab, ac, bb, bc>::key.strategy == detail::label_strategy::hash);
+
+    SASSERT(method("GET") == 1);
+    SASSERT(method("POST") == 2);
+    SASSERT(method("PUT") == 3);
+    SASSERT(method("HEAD") == 4);
+    SASSERT(method("PUSH") == 0);
+    SASSERT(method("GETS") == 0);
+    SASSERT(method("") == 0);
+
+    SASSERT(pairs("ab") == 1);
+    SASSERT(pairs("bc") == 4);
+    SASSERT(pairs("") == 5);
+    SASSERT(pairs("cc") == 0);
+
+    assert(method(std::string("POST")) == 2);
+    assert(method(std::string("post")) == 0);
+    assert(pairs(std::string("ac")) == 2);
+    assert(pairs(std::string("a")) == 0);
+
+    // void functions, and only a default
+    {
+        int called = 0;
+        string_switch(std::string("HEAD"), case_<get>([&]{ called = 1; }), case_<head>([&]{ called = 4; }), default_([&]{ called = -1; }));
+        assert(called == 4);
+        string_switch(std::string("HEAD"), default_([&]{ called = -1; }));
+        assert(called == -1);
+    }
+
+    // the result is the common type
+    typedef decltype(string_switch("x", case_<get>(value{1}), default_(half{}))) mixed_type;
+    IS_SAME(mixed_type, double);
+
+    SASSERT(string_switch(L"lé", case_<meta::basic_string<wchar_t, L'l', L'é'>>(value{1}), default_(value{0})) == 1);
+
+#ifdef FROZEN_HAS_AUTO_NTTP
+    SASSERT(string_switch(make_string("WARN"), case_<error>(value{1}), case_<warn>(value{2}), default_(value{0})) == 2);
+#endif
+
+#ifdef FROZEN_HAS_CLASS_TYPE_NTTP
+    SASSERT(string_switch("DELETE", case_<"GET">(value{1}), case_<"DELETE">(value{2}), default_(value{0})) == 2);
+#endif
+
+    std::cout << make_string("OK\n");
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::cout << make_string("OK\n");
+    return 0;
+}
+
+#endif
@@ -8,6 +8,64 @@ IS_SAME(add_newline<S("hoge")>, S("hoge\n"));
 IS_SAME(push_front<S("hoge"), '?'>, S("?hoge"));
 IS_SAME(cons<char, '?', S("hoge")>, S("?hoge"));
 IS_SAME(pop_front<S("hoge")>, S("oge"));
+IS_SAME(remove_trailing_nuls<5, S("hoge\0\0")>, S("hoge"));
+
+IS_SAME(substr<S("hello world"), 6>, S("world"));
+IS_SAME(substr<S("hello world"), 0, 5>, S("hello"));
+IS_SAME(substr<S("hello world"), 4, 3>, S("o w"));
+IS_SAME(substr<S("hello"), 5>, S(""));
+// substr<S("hello"), 6> fails the "Pos is out of range" static_assert
+
+SASSERT(find<S("hello world"), S("o")>::value == 4);
+SASSERT(find<S("hello world"), S("o"), 5>::value == 7);
+SASSERT(find<S("hello world"), S("world")>::value == 6);
+SASSERT(find<S("hello world"), S("")>::value == 0);
+SASSERT(find<S("hello world"), S("z")>::value == npos);
+
+SASSERT(count<S("hello world"), S("o")>::value == 2);
+SASSERT(count<S("aaaa"), S("aa")>::value == 2);
+SASSERT(count<S("aaa"), S("aa")>::value == 1);
+SASSERT(count<S(""), S("a")>::value == 0);
+// count<S("hello"), S("")> fails the "must not be empty" static_assert
+
+IS_SAME(replace_all<S("a,b,,c"), S(","), S(", ")>, S("a, b, , c"));
+IS_SAME(replace_all<S("aaaa"), S("aa"), S("b")>, S("bb"));
+IS_SAME(replace_all<S("xabcxabc"), S("abc"), S("")>, S("xx"));
+IS_SAME(replace_all<S("hoge"), S("z"), S("zz")>, S("hoge"));
+
+typedef std::tuple<S("a"), S("b"), S(""), S("c")> a_b__c;
+IS_SAME(split<S("a,b,,c"), S(",")>, a_b__c);
+typedef std::tuple<S(""), S("")> two_empties;
+IS_SAME(split<S("::"), S("::")>, two_empties);
+IS_SAME(split<S(""), S(",")>, std::tuple<S("")>);
+
+IS_SAME(reverse<S("abc")>, S("cba"));
+IS_SAME(reverse<S("")>, S(""));
+IS_SAME(to_upper<S("aBc1")>, S("ABC1"));
+IS_SAME(to_lower<S("aBc1")>, S("abc1"));
+
+// longer than FROZEN_FROM_STRING_LITERAL() and than the template
+// instantiation depth limit
+template<class Indices>
+struct letters_;
+
+template<size_t... Indices>
+struct letters_<frozen::detail::indices<Indices...>>
+  : basic_string<char, static_cast<char>('a' + Indices % 26)...>
+{};
+
+template<size_t N>
+using letters = typename letters_<frozen::detail::make_indices<0, N>>::type;
+
+typedef letters<1024> long_string;
+IS_SAME(substr<long_string, 26, 3>, S("abc"));
+IS_SAME(reverse<reverse<long_string>>, long_string);
+IS_SAME(substr<reverse<long_string>, 0, 2>, S("ji"));
+SASSERT(find<long_string, S("xyz")>::value == 23);
+SASSERT(count<long_string, S("q")>::value == 39);
+IS_SAME(replace_all<replace_all<long_string, S("q"), S("QQ")>, S("QQ"), S("q")>, long_string);
+SASSERT(std::tuple_size<split<long_string, S("z")>>::value == 40);
+IS_SAME(std::tuple_element<1, split<long_string, S("z")>>::type, substr<long_string, 0, 25>);
 
 int main()
 {
@@ -0,0 +1,40 @@
+#include <string>
+#include <cassert>
+
+#include "../../frozen/meta/string.hpp"
+#include "../../frozen/string.hpp"
+#include "../util.hpp"
+
+using namespace frozen::meta;
+
+typedef S("hoge") hoge;
+
+SASSERT(sizeof(hoge::value) == 5);
+SASSERT(hoge::value[0] == 'h' && hoge::value[3] == 'e' && hoge::value[4] == '\0');
+SASSERT(sizeof(S("")::value) == 1);
+
+SASSERT(hoge::frozen() == frozen::make_string("hoge"));
+SASSERT(hoge::frozen().size() == 4);
+SASSERT(S(L"ω")::frozen() == frozen::make_string(L"ω"));
+SASSERT(hoge::array().size() == 5);
+
+#ifdef FROZEN_HAS_STRING_VIEW
+SASSERT(hoge::view().size() == 4);
+SASSERT(hoge::view().data() == hoge::value);
+SASSERT(S("")::view().empty());
+#endif
+
+int main()
+{
+    // the same storage however the type is spelled
+    typedef string<'h', 'o', 'g', 'e'> spelled_out;
+    assert(&hoge::value[0] == &spelled_out::value[0]);
+
+    assert(hoge::array()[2] == 'g');
+    assert(hoge::to_std_string() == "hoge");
+    assert(S(L"ω")::to_std_string() == std::wstring(L"ω"));
+    assert(S(u"ab")::to_std_string() == std::u16string(u"ab"));
+
+    std::cout << "OK\n";
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include <cassert>
+
+#include "../../frozen/meta/string_without_boost.hpp"
+#include "../../frozen/string.hpp"
+#include "../util.hpp"
+
+#ifdef FROZEN_HAS_CLASS_TYPE_NTTP
+
+using namespace frozen::meta;
+
+typedef basic_string<char, 'h', 'o', 'g', 'e'> hoge;
+
+// string literals
+IS_SAME(from<"hoge">, hoge);
+IS_SAME(from<"">, basic_string<char>);
+IS_SAME(from<u"ab">, basic_string<char16_t, u'a', u'b'>);
+IS_SAME(from<L"\u03c9">, basic_string<wchar_t, L'\u03c9'>);
+typedef basic_string<char, 'a', '\0', 'b'> embedded_nul;
+IS_SAME(from<"a\0b">, embedded_nul);
+
+// constexpr frozen::basic_string values
+constexpr frozen::string<16> hoge_value = "hoge";
+IS_SAME(from<hoge_value>, hoge);
+IS_SAME(from<frozen::make_string("hoge")>, hoge);
+IS_SAME(from<frozen::empty_str>, basic_string<char>);
+typedef basic_string<char, '-', '4', '2'> minus_42;
+IS_SAME(from<frozen::to_string(-42)>, minus_42);
+IS_SAME(from<frozen::make_string("ho") + "ge">, hoge);
+
+// longer than BOOST_PP_LIMIT_REPEAT
+typedef from<"abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijklmn"> long_string;
+SASSERT(sizeof(long_string::value) == 301);
+
+#endif
+
+int main()
+{
+#ifdef FROZEN_HAS_CLASS_TYPE_NTTP
+    assert(long_string::value[0] == 'a' && long_string::value[299] == 'n');
+#endif
+
+    std::cout << "OK\n";
+    return 0;
+}
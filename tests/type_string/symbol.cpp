@@ -0,0 +1,44 @@
+#include <string>
+#include <cassert>
+
+#include "../../frozen/meta/string.hpp"
+#include "../../frozen/string.hpp"
+#include "../util.hpp"
+
+using namespace frozen::meta;
+
+typedef symbol_table<S("orders"), S("trades"), S("quotes"), S("")> topics;
+
+SASSERT(topics::size == 4);
+SASSERT(topics::id<S("orders")>::value == 0);
+SASSERT(topics::id<S("trades")>::value == 1);
+SASSERT(topics::id<S("")>::value == 3);
+SASSERT(symbol_id<S("quotes"), topics>::value == 2);
+SASSERT(topics::id<S("orders")>::value != topics::id<S("quotes")>::value);
+
+SASSERT(symbol_hash<S("hoge")>::value == frozen::make_string("hoge").hash());
+SASSERT(symbol_hash<S("")>::value == frozen::make_string("").hash());
+SASSERT(symbol_hash<S(L"ω")>::value == frozen::make_string(L"ω").hash());
+
+int main()
+{
+    // a table keyed by symbols is an array
+    int counts[topics::size] = {};
+    ++counts[topics::id<S("trades")>::value];
+    assert(counts[1] == 1);
+
+#ifdef FROZEN_HAS_RELAXED_CONSTEXPR
+    SASSERT(topics::intern("orders") == 0);
+    SASSERT(topics::intern("quotes") == 2);
+    SASSERT(topics::intern("") == 3);
+    SASSERT(topics::intern("order") == topics::unknown);
+    SASSERT(topics::intern(frozen::make_string("trades")) == topics::id<S("trades")>::value);
+
+    std::string const name = "trades";
+    assert(topics::intern(name) == 1);
+    assert(topics::intern(std::string("tradesX")) == topics::unknown);
+#endif
+
+    std::cout << "OK\n";
+    return 0;
+}
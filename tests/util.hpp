@@ -13,7 +13,7 @@
 
 namespace test_frozen{
 template<class T>
-constexpr T is_constexpr_impl(T x) throw(int)
+constexpr T is_constexpr_impl(T x) noexcept(false)
 {
   return x;
 }